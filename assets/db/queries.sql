@@ -155,6 +155,13 @@ VALUES (1, ?, ?, ?);
 -- @QUERY_ID: SELECT_GAME_STATE
 SELECT managed_team_id, game_date, current_season FROM GameState WHERE id = 1;
 
+-- @QUERY_ID: UPSERT_RANDOM_STREAM
+INSERT OR REPLACE INTO RandomStreams (stream, seed, position)
+VALUES (?, ?, ?);
+
+-- @QUERY_ID: SELECT_RANDOM_STREAMS
+SELECT stream, seed, position FROM RandomStreams;
+
 -- ==========================================
 -- LEAGUE POINTS
 -- ==========================================
@@ -182,3 +189,14 @@ DELETE FROM TransferList WHERE player_id = ?;
 
 -- @QUERY_ID: LOAD_ALL_TRANSFER_LISTINGS
 SELECT player_id, asking_price, listing_date FROM TransferList;
+
+-- ==========================================
+-- PLAYER HEATMAPS
+-- ==========================================
+
+-- @QUERY_ID: UPSERT_PLAYER_HEATMAP
+INSERT OR REPLACE INTO PlayerHeatmaps (season, player_id, data)
+VALUES (?, ?, ?);
+
+-- @QUERY_ID: SELECT_PLAYER_HEATMAPS_BY_SEASON
+SELECT player_id, data FROM PlayerHeatmaps WHERE season = ?;
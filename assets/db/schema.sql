@@ -82,5 +82,20 @@ CREATE TABLE IF NOT EXISTS TransferList (
     FOREIGN KEY(player_id) REFERENCES Players(id)
 );
 
+-- Season heatmaps of the players, encoded by SeasonHeatmap::encode()
+CREATE TABLE IF NOT EXISTS PlayerHeatmaps (
+    season INTEGER NOT NULL,
+    player_id INTEGER NOT NULL,
+    data BLOB NOT NULL,
+    PRIMARY KEY(season, player_id)
+);
+
+-- Position of every RandomService stream, see RandomStream::seek()
+CREATE TABLE IF NOT EXISTS RandomStreams (
+    stream INTEGER PRIMARY KEY,
+    seed INTEGER NOT NULL,
+    position INTEGER NOT NULL
+);
+
 -- Enable WAL mode
 PRAGMA journal_mode=WAL;
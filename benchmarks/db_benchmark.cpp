@@ -15,6 +15,7 @@
 #include "database/repositories/player_repository.h"
 #include "database/gamedata.h"
 #include "global/paths.h"
+#include "global/random_stream.h"
 
 
 // Set up the database environment for benchmarks
@@ -35,12 +36,13 @@ class DatabaseFixture : public benchmark::Fixture {
 
   std::shared_ptr<DatabaseConnection> db_conn;
   GameData gamedata;
+  RandomStream rng;
 };
 
 BENCHMARK_DEFINE_F(DatabaseFixture, BM_LoadFromDB)(benchmark::State& state) {
   state.PauseTiming();
   // Pre-load initial data
-  gamedata.loadFromDB(db_conn);
+  gamedata.loadFromDB(db_conn, rng);
 
   int target_players = state.range(0);
   int current_players = gamedata.getPlayers().size();
@@ -55,14 +57,14 @@ BENCHMARK_DEFINE_F(DatabaseFixture, BM_LoadFromDB)(benchmark::State& state) {
 
   for (auto _ : state) {
     (void)_;
-    gamedata.loadFromDB(db_conn);
+    gamedata.loadFromDB(db_conn, rng);
   }
 }
 
 BENCHMARK_DEFINE_F(DatabaseFixture, BM_SaveToDB)(benchmark::State& state) {
   state.PauseTiming();
   // Pre-load data
-  gamedata.loadFromDB(db_conn);
+  gamedata.loadFromDB(db_conn, rng);
 
   int target_players = state.range(0);
   int current_players = gamedata.getPlayers().size();
@@ -93,7 +95,7 @@ BENCHMARK_REGISTER_F(DatabaseFixture, BM_SaveToDB)
 
 BENCHMARK_DEFINE_F(DatabaseFixture, BM_GetPlayersForTeam)(benchmark::State& state) {
   // Pre-load data
-  gamedata.loadFromDB(db_conn);
+  gamedata.loadFromDB(db_conn, rng);
 
   int target_players = state.range(0);
   int current_players = gamedata.getPlayers().size();
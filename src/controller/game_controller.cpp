@@ -16,11 +16,13 @@
 #include <ctime>
 #include <filesystem>
 #include <iomanip>
+#include <span>
 #include <sstream>
 
 #include "database/gamedata.h"
 #include "database/repositories/player_repository.h"
 #include "global/global.h"
+#include "global/logger.h"
 
 GameController::GameController() : game(nullptr), gamedata(nullptr) {}
 
@@ -39,16 +41,40 @@ std::string GameController::getSavePath(int slot) const
   return p.string();
 }
 
-void GameController::newGame(int slot)
+std::string GameController::getReplayPath(GameDateValue date,
+                                          uint16_t home_id,
+                                          uint16_t away_id) const
 {
-  std::string path = getSavePath(slot);
+  std::string name = date.toString() + "_" + std::to_string(home_id) + "_" +
+                     std::to_string(away_id) + ".fmr";
+  char* prefPath = SDL_GetPrefPath("FlavioMili", "FootballManagement");
+  if (!prefPath)
+  {
+    return "replays/" + name;
+  }
+  std::filesystem::path p(prefPath);
+  SDL_free(prefPath);
+
+  p /= "replays";
+  p /= name;
+  return p.string();
+}
+
+void GameController::newGame(int slot) { newGameAt(getSavePath(slot)); }
+
+void GameController::newGameAt(const std::string& path,
+                               std::optional<uint64_t> seed)
+{
+  resetPrediction();
   if (std::filesystem::exists(path))
   {
     std::filesystem::remove(path);
   }
   gamedata = std::make_shared<GameData>();
   db_conn = std::make_shared<DatabaseConnection>(path);
-  game = std::make_unique<Game>(gamedata, db_conn);
+  game = std::make_unique<Game>(gamedata, db_conn, seed);
+  // The user plays the managed team's matches, see setMatchResult()
+  game->setManagedFixturesDeferred(true);
   transfer_listings.clear();
 
   // Seed the transfer market with some initial listings
@@ -60,14 +86,20 @@ void GameController::newGame(int slot)
 
 bool GameController::loadGame(int slot)
 {
-  std::string path = getSavePath(slot);
+  return loadGameAt(getSavePath(slot));
+}
+
+bool GameController::loadGameAt(const std::string& path)
+{
   if (!std::filesystem::exists(path))
   {
     return false;
   }
+  resetPrediction();
   gamedata = std::make_shared<GameData>();
   db_conn = std::make_shared<DatabaseConnection>(path);
   game = std::make_unique<Game>(gamedata, db_conn);
+  game->setManagedFixturesDeferred(true);
 
   // Load transfer listings
   auto loaded = gamedata->loadAllTransferListings();
@@ -175,11 +207,108 @@ const StatsConfig& GameController::getStatsConfig() const
 
 void GameController::advanceDay()
 {
-  game->advanceDay();
-  if (isTransferWindowOpen())
+  advance(1, [](const GameEvent&) { return false; });
+}
+
+int GameController::advanceDays(int days)
+{
+  return advance(days, [](const GameEvent&) { return false; });
+}
+
+int GameController::advanceUntil(AdvanceTarget target)
+{
+  switch (target)
   {
-    processAITransferActivity();
+    case AdvanceTarget::NEXT_MANAGED_FIXTURE:
+      break;  // Every advance stops there
+    case AdvanceTarget::TRANSFER_WINDOW_CLOSE:
+      return advance(MAX_ADVANCE_DAYS,
+                     [](const GameEvent& event)
+                     {
+                       return event.type ==
+                              GameEventType::TRANSFER_WINDOW_CLOSE;
+                     });
+    case AdvanceTarget::SEASON_END:
+      return advance(MAX_ADVANCE_DAYS,
+                     [](const GameEvent& event)
+                     { return event.type == GameEventType::SEASON_ROLLOVER; });
+  }
+  return advance(MAX_ADVANCE_DAYS, [](const GameEvent&) { return false; });
+}
+
+int GameController::advance(
+    int max_days, const std::function<bool(const GameEvent&)>& reached)
+{
+  if (!game || max_days <= 0) return 0;
+
+  // Training and aging modify the players a prediction is reading
+  resetPrediction();
+
+  // Listings and transfers write to the database as they happen; group them
+  // into one commit, and the saves after transfers into one at the end
+  const GameDateValue start = game->getCurrentDate();
+  const GameDateValue limit = start + static_cast<size_t>(max_days);
+  advancing = true;
+  save_pending = false;
+  db_conn->beginTransaction();
+  try
+  {
+    // Only days with scheduled events are visited
+    bool stop = false;
+    while (!stop && game->getCurrentDate() < limit)
+    {
+      for (const GameEvent& event : game->advanceToNextEvent(limit))
+      {
+        if (event.type == GameEventType::MARKET_TICK)
+        {
+          const auto tick_start = GameTimings::Clock::now();
+          processAITransferActivity();
+          game->getTimings().add(GameTimings::AI_TRANSFERS, tick_start);
+        }
+        stop = stop || reached(event) ||
+               (event.type == GameEventType::FIXTURES &&
+                hasManagedFixtureToday());
+      }
+    }
+    advancing = false;
+    if (save_pending) saveGame();
+    const auto commit_start = GameTimings::Clock::now();
+    db_conn->commitTransaction();
+    game->getTimings().add(GameTimings::PERSISTENCE, commit_start);
+  }
+  catch (const std::exception& e)
+  {
+    advancing = false;
+    db_conn->rollbackTransaction();
+    Logger::error("Failed to advance the game: " + std::string(e.what()));
+    throw;
+  }
+  return start.daysUntil(game->getCurrentDate());
+}
+
+bool GameController::hasManagedFixtureToday() const
+{
+  const TeamID managed_id = game->getManagedTeamId();
+  if (managed_id == FREE_AGENTS_TEAM_ID) return false;
+
+  const auto& matches =
+      game->getCalendar().getMatchesForDate(game->getCurrentDate());
+  return std::ranges::any_of(matches,
+                             [managed_id](const Match& m)
+                             {
+                               return m.getHomeTeamId() == managed_id ||
+                                      m.getAwayTeamId() == managed_id;
+                             });
+}
+
+void GameController::saveAfterChange()
+{
+  if (advancing)
+  {
+    save_pending = true;
+    return;
   }
+  saveGame();
 }
 
 void GameController::setMatchResult(GameDateValue date, uint16_t home_id,
@@ -193,15 +322,112 @@ void GameController::setMatchResult(GameDateValue date, uint16_t home_id,
     {
       if (m.getHomeTeamId() == home_id && m.getAwayTeamId() == away_id)
       {
-        m.setPlayedResult(home_score, away_score);
+        if (!game->recordMatchResult(m, home_score, away_score))
+        {
+          Logger::warn("Match " + std::to_string(home_id) + " v " +
+                       std::to_string(away_id) + " was already played");
+        }
         break;
       }
     }
   }
 }
 
+MatchHeatmaps& GameController::acquireMatchHeatmaps()
+{
+  if (!match_heatmaps)
+  {
+    match_heatmaps = std::make_unique<MatchHeatmaps>();
+  }
+  match_heatmaps->clear();
+  return *match_heatmaps;
+}
+
+void GameController::addMatchHeatmaps(const MatchStats& stats,
+                                      const MatchHeatmaps& heatmaps)
+{
+  if (game) game->addMatchHeatmaps(stats, heatmaps);
+}
+
+const SeasonHeatmap* GameController::getSeasonHeatmap(PlayerID player_id) const
+{
+  return game ? game->getSeasonHeatmap(player_id) : nullptr;
+}
+
 void GameController::saveGame() { game->saveGame(); }
 
+std::optional<Match> GameController::getNextFixture(TeamID team_id) const
+{
+  if (!game) return std::nullopt;
+
+  const auto& calendar = game->getCalendar().getFullCalendar();
+  for (auto it = calendar.lower_bound(game->getCurrentDate());
+       it != calendar.end(); ++it)
+  {
+    for (const auto& m : it->second)
+    {
+      if (!m.isPlayed() &&
+          (m.getHomeTeamId() == team_id || m.getAwayTeamId() == team_id))
+      {
+        return m;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+void GameController::predictNextFixture(
+    const std::optional<StrategySliders>& managed_sliders)
+{
+  auto managed = getManagedTeam();
+  if (!managed.has_value())
+  {
+    resetPrediction();
+    return;
+  }
+
+  TeamID managed_id = managed->get().getId();
+  predicted_fixture = getNextFixture(managed_id);
+  if (!predicted_fixture.has_value())
+  {
+    resetPrediction();
+    return;
+  }
+
+  auto home = gamedata->getTeam(predicted_fixture->getHomeTeamId());
+  auto away = gamedata->getTeam(predicted_fixture->getAwayTeamId());
+  if (!home.has_value() || !away.has_value())
+  {
+    resetPrediction();
+    return;
+  }
+
+  predicted_away = predicted_fixture->getAwayTeamId() == managed_id;
+  Strategy home_strategy = home->get().getStrategy();
+  Strategy away_strategy = away->get().getStrategy();
+  if (managed_sliders.has_value())
+  {
+    (predicted_away ? away_strategy : home_strategy)
+        .setAllSliders(*managed_sliders);
+  }
+
+  predictor.predict(home->get().getLineup(), away->get().getLineup(),
+                    home_strategy, away_strategy, getStatsConfig());
+}
+
+MatchPrediction GameController::getNextFixturePrediction() const
+{
+  MatchPrediction prediction = predictor.getPrediction();
+  return predicted_away ? prediction.flipped() : prediction;
+}
+
+void GameController::resetPrediction()
+{
+  predictor.cancel();
+  predicted_fixture.reset();
+  predicted_away = false;
+}
+
 GameController::SaveSlotMetadata GameController::getSaveSlotMetadata(
     int slot) const
 {
@@ -434,7 +660,7 @@ void GameController::executeTransfer(PlayerID pid, TeamID buyer_id,
   gamedata->transferPlayer(pid, buyer_id);
   transfer_listings.erase(pid);
 
-  saveGame();
+  saveAfterChange();
 }
 
 // ========== Buy + Sign + Market Value ==========
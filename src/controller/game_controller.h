@@ -11,13 +11,14 @@
 #include <functional>
 #include <memory>
 #include <optional>
-#include <random>
 #include <unordered_map>
 #include <vector>
 
 #include "global/stats_config.h"
 #include "model/game.h"
 #include "model/league.h"
+#include "model/match.h"
+#include "model/match_predictor.h"
 #include "model/player.h"
 #include "model/team.h"
 #include "model/transfer_listing.h"
@@ -51,12 +52,25 @@ class GameController
    */
   void newGame(int slot);
 
+  /**
+   * @brief Starts a new game in the database file at @p path, replacing it.
+   * @param seed Seed of the new world, a fresh one if not given.
+   */
+  void newGameAt(const std::string& path,
+                 std::optional<uint64_t> seed = std::nullopt);
+
   /**
    * @brief Loads an existing game from the given save slot.
    * @return True if loaded successfully, false otherwise.
    */
   bool loadGame(int slot);
 
+  /**
+   * @brief Loads an existing game from the database file at @p path.
+   * @return True if loaded successfully, false otherwise.
+   */
+  bool loadGameAt(const std::string& path);
+
   /**
    * @brief Checks if a game is currently loaded.
    */
@@ -148,14 +162,74 @@ class GameController
    */
   const StatsConfig& getStatsConfig() const;
 
+  /** @brief Where advanceUntil() stops. */
+  enum class AdvanceTarget : uint8_t
+  {
+    NEXT_MANAGED_FIXTURE,  /*!< The next day the managed team plays */
+    TRANSFER_WINDOW_CLOSE, /*!< The first day after a transfer window */
+    SEASON_END             /*!< The first day of the next season */
+  };
+
+  /** @brief Most days advanceUntil() runs, enough to reach any target. */
+  static constexpr int MAX_ADVANCE_DAYS = 366;
+
   /**
    * @brief Advances the game date by one day.
    */
   void advanceDay();
 
+  /**
+   * @brief Advances up to @p days days, stopping early on a day the managed
+   * team plays so that its match can be watched.
+   *
+   * Days without scheduled events are skipped over, the others run the
+   * same steps as advanceDay(). The prediction is cancelled once and all
+   * database writes of the run share one transaction, with at most one game
+   * save at the end.
+   * @return The number of days advanced.
+   */
+  int advanceDays(int days);
+
+  /**
+   * @brief Advances like advanceDays() until @p target is reached, or a day
+   * the managed team plays comes first.
+   * @return The number of days advanced.
+   */
+  int advanceUntil(AdvanceTarget target);
+
+  /**
+   * @brief Plays the managed team's fixture of @p date, left unplayed by
+   * advancing, with the score of the watched match. A fixture already played
+   * keeps its result.
+   */
   void setMatchResult(GameDateValue date, uint16_t home_id, uint16_t away_id,
                       uint8_t home_score, uint8_t away_score);
 
+  /**
+   * @brief Location of the replay file of a fixture, in the user's data
+   * directory.
+   */
+  std::string getReplayPath(GameDateValue date, uint16_t home_id,
+                            uint16_t away_id) const;
+
+  /**
+   * @brief Heatmap grids shared by every watched match, allocated on first
+   * use and cleared for each caller. Only one match is watched at a time.
+   */
+  MatchHeatmaps& acquireMatchHeatmaps();
+
+  /**
+   * @brief Adds the heatmaps of a watched match to the season heatmaps of
+   * its players.
+   */
+  void addMatchHeatmaps(const MatchStats& stats, const MatchHeatmaps& heatmaps);
+
+  /**
+   * @brief Gets a player's heatmap over the current season.
+   * @return Null if none of the player's matches were tracked.
+   */
+  const SeasonHeatmap* getSeasonHeatmap(PlayerID player_id) const;
+
   /**
    * @brief Saves the current state of the game.
    */
@@ -166,6 +240,35 @@ class GameController
    */
   SaveSlotMetadata getSaveSlotMetadata(int slot) const;
 
+  // ========== Match Prediction ==========
+
+  /**
+   * @brief Finds the first unplayed fixture of a team from today onwards.
+   * @param team_id The ID of the team.
+   */
+  std::optional<Match> getNextFixture(TeamID team_id) const;
+
+  /**
+   * @brief Starts predicting the managed team's next fixture in the
+   * background, replacing the previous prediction.
+   * @param managed_sliders Sliders to evaluate for the managed team instead
+   * of its saved strategy, e.g. while they are being edited.
+   */
+  void predictNextFixture(
+      const std::optional<StrategySliders>& managed_sliders = std::nullopt);
+
+  /**
+   * @brief Current estimate for the predicted fixture, from the managed
+   * team's side (home fields refer to the managed team).
+   */
+  MatchPrediction getNextFixturePrediction() const;
+
+  /** @brief The fixture being predicted, if any. */
+  const std::optional<Match>& getPredictedFixture() const
+  {
+    return predicted_fixture;
+  }
+
   // ========== Transfer Market: Listing ==========
   void listPlayerForTransfer(PlayerID player_id, uint32_t asking_price);
   void removePlayerFromTransfer(PlayerID player_id);
@@ -226,14 +329,14 @@ class GameController
   PlayerRole getRoleCategory(PlayerRole role) const;
   uint32_t transferBudgetForTeam(TeamID team_id) const;
 
-  static float randomFloat(float min, float max)
+  // AI market draws, from the game's saved transfer stream
+  float randomFloat(float min, float max)
   {
-    std::random_device rd;
-    std::uniform_real_distribution<float> dis(min, max);
-    return dis(rd);
+    return game->getRandom().stream(RandomService::TRANSFERS).uniform(min, max);
   }
 
   const Game* getGame() const { return game.get(); }
+  Game* getGame() { return game.get(); }
 
   /** @brief Gets the database connection (for repos that need it). */
   std::shared_ptr<DatabaseConnection> getDbConn() const { return db_conn; }
@@ -247,9 +350,35 @@ class GameController
   std::shared_ptr<class GameData> gamedata;
 
   std::unordered_map<PlayerID, TransferListing> transfer_listings;
+  std::unique_ptr<MatchHeatmaps> match_heatmaps;
+
+  // While advancing several days, saves are deferred to the end of the run
+  bool advancing = false;
+  bool save_pending = false;
+
   void executeTransfer(PlayerID pid, TeamID buyer_id, TeamID seller_id,
                        uint32_t price);
   void processAITransferActivity();
 
+  /**
+   * @brief The multi-day pipeline: jumps from one scheduled event to the next
+   * until @p reached returns true for an event, a managed fixture is due or
+   * @p max_days days have passed.
+   */
+  int advance(int max_days,
+              const std::function<bool(const GameEvent&)>& reached);
+  bool hasManagedFixtureToday() const;
+  /** @brief Saves the game now, or at the end of the running advance. */
+  void saveAfterChange();
+
   std::string getSavePath(int slot) const;
+
+  /** @brief Cancels the running prediction and forgets its fixture. */
+  void resetPrediction();
+
+  // Declared last so that it is destroyed, and its runs stopped, before the
+  // game data they read
+  MatchPredictor predictor;
+  std::optional<Match> predicted_fixture;
+  bool predicted_away = false;
 };
@@ -79,33 +79,40 @@ void DatabaseConnection::initialize() const
 
 void DatabaseConnection::beginTransaction() const
 {
+  const char* sql =
+      transaction_depth == 0 ? "BEGIN TRANSACTION;" : "SAVEPOINT nested;";
   char* err_msg = nullptr;
-  if (sqlite3_exec(db.get(), "BEGIN TRANSACTION;", nullptr, nullptr,
-                   &err_msg) != SQLITE_OK)
+  if (sqlite3_exec(db.get(), sql, nullptr, nullptr, &err_msg) != SQLITE_OK)
   {
     std::string err = err_msg ? err_msg : "Unknown error";
     if (err_msg) sqlite3_free(err_msg);
     throw DatabaseException("Failed to begin transaction: " + err);
   }
+  ++transaction_depth;
 }
 
 void DatabaseConnection::commitTransaction() const
 {
+  const char* sql = transaction_depth > 1 ? "RELEASE nested;" : "COMMIT;";
   char* err_msg = nullptr;
-  if (sqlite3_exec(db.get(), "COMMIT;", nullptr, nullptr, &err_msg) !=
-      SQLITE_OK)
+  if (sqlite3_exec(db.get(), sql, nullptr, nullptr, &err_msg) != SQLITE_OK)
   {
     std::string err = err_msg ? err_msg : "Unknown error";
     if (err_msg) sqlite3_free(err_msg);
     throw DatabaseException("Failed to commit transaction: " + err);
   }
+  if (transaction_depth > 0) --transaction_depth;
 }
 
 void DatabaseConnection::rollbackTransaction() const
 {
+  // A savepoint stays open after ROLLBACK TO, release it as well
+  const char* sql = transaction_depth > 1
+                        ? "ROLLBACK TO nested; RELEASE nested;"
+                        : "ROLLBACK;";
+  if (transaction_depth > 0) --transaction_depth;
   char* err_msg = nullptr;
-  if (sqlite3_exec(db.get(), "ROLLBACK;", nullptr, nullptr, &err_msg) !=
-      SQLITE_OK)
+  if (sqlite3_exec(db.get(), sql, nullptr, nullptr, &err_msg) != SQLITE_OK)
   {
     std::string err = err_msg ? err_msg : "Unknown error";
     if (err_msg) sqlite3_free(err_msg);
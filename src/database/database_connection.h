@@ -42,17 +42,21 @@ class DatabaseConnection
   sqlite3* getRaw() const { return db.get(); }
 
   /**
-   * @brief Begins a new SQLite transaction.
+   * @brief Begins a new SQLite transaction, or a savepoint nested in the
+   * transaction already open, so callers can group work that opens its own
+   * transactions into one commit.
    */
   void beginTransaction() const;
 
   /**
-   * @brief Commits the current SQLite transaction.
+   * @brief Commits the current SQLite transaction, or releases the innermost
+   * savepoint into the enclosing transaction.
    */
   void commitTransaction() const;
 
   /**
-   * @brief Rolls back the current SQLite transaction.
+   * @brief Rolls back the current SQLite transaction, or only the work since
+   * the innermost savepoint.
    */
   void rollbackTransaction() const;
 
@@ -62,5 +66,6 @@ class DatabaseConnection
  private:
   std::unique_ptr<sqlite3, decltype(&sqlite3_close)> db{nullptr,
                                                         &sqlite3_close};
+  mutable int transaction_depth = 0;  // Open transaction plus savepoints
   void loadSQLFiles() const;
 };
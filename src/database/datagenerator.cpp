@@ -11,7 +11,6 @@
 #include <filesystem>
 #include <fstream>
 #include <nlohmann/json.hpp>
-#include <random>
 #include <string>
 #include <vector>
 
@@ -56,41 +55,37 @@ void DataGenerator::loadNames()
 }
 
 Player DataGenerator::generateRandomPlayer(const GameData& gamedata,
-                                           TeamID team_id)
+                                           TeamID team_id, RandomStream& rng)
 {
   static uint32_t next_player_id = 50000;
   auto stats_config = gamedata.getStatsConfig();
-  static std::mt19937 gen(std::random_device{}());
-  std::uniform_int_distribution<size_t> name_dist(0, first_names.size() - 1);
-  std::uniform_int_distribution<size_t> last_name_dist(0,
-                                                       last_names.size() - 1);
-  std::uniform_int_distribution<int> age_dist(18, 35);
-  std::uniform_int_distribution<int> contract_dist(1, 5);
-  std::uniform_int_distribution<int> height_dist(165, 200);
-  std::uniform_int_distribution<int> wage_dist(500, 10000);
-  std::uniform_int_distribution<size_t> role_dist(
-      0, stats_config.role_focus.size() - 1);
-  std::uniform_int_distribution<int> foot_dist(0, 1);
-
-  std::string first_name = first_names[name_dist(gen)];
-  std::string last_name = last_names[last_name_dist(gen)];
-  int age = age_dist(gen);
-  int contract_years = contract_dist(gen);
-  int height = height_dist(gen);
-  int wage = wage_dist(gen);
+  // Integer ranges are inclusive, as with the distributions they replace
+  auto between = [&rng](int lo, int hi)
+  {
+    return lo + static_cast<int>(rng.below(static_cast<uint32_t>(hi - lo + 1)));
+  };
+
+  std::string first_name =
+      first_names[rng.below(static_cast<uint32_t>(first_names.size()))];
+  std::string last_name =
+      last_names[rng.below(static_cast<uint32_t>(last_names.size()))];
+  int age = between(18, 35);
+  int contract_years = between(1, 5);
+  int height = between(165, 200);
+  int wage = between(500, 10000);
 
   auto it = stats_config.role_focus.begin();
-  std::advance(it, role_dist(gen));
+  std::advance(it, rng.below(static_cast<uint32_t>(
+                       stats_config.role_focus.size())));
   std::string role = it->first;
 
-  Foot foot = (foot_dist(gen) == 0) ? Foot::Left : Foot::Right;
+  Foot foot = (rng.below(2) == 0) ? Foot::Left : Foot::Right;
 
   std::map<std::string, float> stats;
   const auto& possible_stats = stats_config.possible_stats;
-  std::uniform_real_distribution<float> stat_dist(20.0, 80.0);
   for (const auto& stat_name : possible_stats)
   {
-    stats[stat_name] = stat_dist(gen);
+    stats[stat_name] = rng.uniform(20.0f, 80.0f);
   }
 
   Logger::debug("Generated Player with ID: " + std::to_string(next_player_id));
@@ -145,7 +140,8 @@ std::vector<Team> DataGenerator::generateTeams()
   return teams;
 }
 
-std::vector<Player> DataGenerator::generatePlayers(const GameData& gamedata)
+std::vector<Player> DataGenerator::generatePlayers(const GameData& gamedata,
+                                                   RandomStream& rng)
 {
   loadNames();
   std::vector<Player> players;
@@ -204,7 +200,7 @@ std::vector<Player> DataGenerator::generatePlayers(const GameData& gamedata)
                     " new players for " + team.getName());
       for (int i = 0; i < players_to_generate; ++i)
       {
-        players.push_back(generateRandomPlayer(gamedata, team.getId()));
+        players.push_back(generateRandomPlayer(gamedata, team.getId(), rng));
       }
     }
   }
@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 
+#include "global/random_stream.h"
 #include "league.h"
 #include "player.h"
 #include "team.h"
@@ -38,9 +39,11 @@ class DataGenerator
 
   /**
    * @brief Generate a collection of players.
+   * @param rng Stream the players filling up the rosters are drawn from.
    * @return A vector of generated Player objects.
    */
-  static std::vector<Player> generatePlayers(const class GameData& gamedata);
+  static std::vector<Player> generatePlayers(const class GameData& gamedata,
+                                             RandomStream& rng);
 
  private:
   static std::vector<std::string> first_names;
@@ -48,5 +51,5 @@ class DataGenerator
 
   static void loadNames();
   static Player generateRandomPlayer(const class GameData& gamedata,
-                                     TeamID team_id);
+                                     TeamID team_id, RandomStream& rng);
 };
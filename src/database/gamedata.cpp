@@ -27,7 +27,8 @@
 GameData::GameData() = default;
 
 // ---------------- DB ----------------
-bool GameData::loadFromDB(std::shared_ptr<DatabaseConnection> database_ptr)
+bool GameData::loadFromDB(std::shared_ptr<DatabaseConnection> database_ptr,
+                          RandomStream& generation_rng)
 {
   _leagues.clear();
   _teams.clear();
@@ -49,7 +50,7 @@ bool GameData::loadFromDB(std::shared_ptr<DatabaseConnection> database_ptr)
 
   if (is_first_run)
   {
-    generateAndSaveInitialData();
+    generateAndSaveInitialData(generation_rng);
   }
   else
   {
@@ -72,7 +73,7 @@ bool GameData::loadFromDB(std::shared_ptr<DatabaseConnection> database_ptr)
   return true;
 }
 
-void GameData::generateAndSaveInitialData()
+void GameData::generateAndSaveInitialData(RandomStream& rng)
 {
   TeamRepository teamRepo(db_conn);
   LeagueRepository leagueRepo(db_conn);
@@ -82,7 +83,8 @@ void GameData::generateAndSaveInitialData()
   sqlite3_exec(
       db_conn->getRaw(),
       "DELETE FROM Players; DELETE FROM Teams; DELETE FROM Leagues; DELETE "
-      "FROM GameState; DELETE FROM LeaguePoints; DELETE FROM Fixtures;",
+      "FROM GameState; DELETE FROM LeaguePoints; DELETE FROM Fixtures; "
+      "DELETE FROM RandomStreams;",
       nullptr, nullptr, nullptr);
   sqlite3_exec(db_conn->getRaw(),
                "INSERT OR IGNORE INTO Teams (id, league_id, name, balance) "
@@ -126,7 +128,7 @@ void GameData::generateAndSaveInitialData()
   _teamsVec.reserve(_teams.size());
   for (auto& [id, team] : _teams) _teamsVec.push_back(team);
 
-  auto players = DataGenerator::generatePlayers(*this);
+  auto players = DataGenerator::generatePlayers(*this, rng);
   for (const auto& player : players)
   {
     auto it = _players.try_emplace(player.getId(), player).first;
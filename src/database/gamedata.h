@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "gamedate.h"
+#include "global/random_stream.h"
 #include "global/stats_config.h"
 #include "global/types.h"
 #include "model/league.h"
@@ -50,9 +51,12 @@ class GameData
   /**
    * @brief Loads the initial game state from the database.
    * @param database_ptr Shared pointer to the active DatabaseConnection.
+   * @param generation_rng Stream a new world's players are drawn from, if the
+   * database is empty.
    * @return True if successful, false otherwise.
    */
-  bool loadFromDB(std::shared_ptr<DatabaseConnection> database_ptr);
+  bool loadFromDB(std::shared_ptr<DatabaseConnection> database_ptr,
+                  RandomStream& generation_rng);
 
   /**
    * @brief Saves the current in-memory state back to the database.
@@ -132,6 +136,6 @@ class GameData
   std::shared_ptr<DatabaseConnection> db_conn;
 
   void loadStatsConfig();
-  void generateAndSaveInitialData();
+  void generateAndSaveInitialData(RandomStream& rng);
   void loadExistingData();
 };
@@ -10,6 +10,7 @@
 
 #include <sqlite3.h>
 
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 
@@ -40,8 +41,8 @@ std::vector<Match> FixtureRepository::loadAllMatches() const
 {
   std::vector<Match> matches;
   sqlite3_stmt* stmt = db_conn->prepareStatement(
-      "SELECT home_team_id, away_team_id, game_date, match_type FROM "
-      "Fixtures;");
+      "SELECT home_team_id, away_team_id, game_date, match_type, home_goals, "
+      "away_goals, played FROM Fixtures;");
 
   while (sqlite3_step(stmt) == SQLITE_ROW)
   {
@@ -51,8 +52,13 @@ std::vector<Match> FixtureRepository::loadAllMatches() const
         reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
     auto match_type = static_cast<MatchType>(sqlite3_column_int(stmt, 3));
 
-    matches.emplace_back(home_id, away_id, GameDateValue::fromString(date_str),
-                         match_type);
+    Match& match = matches.emplace_back(
+        home_id, away_id, GameDateValue::fromString(date_str), match_type);
+    if (sqlite3_column_int(stmt, 6) != 0)
+    {
+      match.setPlayedResult(static_cast<uint8_t>(sqlite3_column_int(stmt, 4)),
+                            static_cast<uint8_t>(sqlite3_column_int(stmt, 5)));
+    }
   }
 
   sqlite3_finalize(stmt);
@@ -84,6 +90,32 @@ void FixtureRepository::saveCalendar(const Calendar& calendar) const
     }
   }
   sqlite3_finalize(stmt);
+
+  for (const auto& [matchDay, matches] : calendar.getFullCalendar())
+  {
+    if (std::ranges::any_of(matches, &Match::isPlayed)) saveResults(matches);
+  }
+}
+
+void FixtureRepository::saveResults(std::span<const Match> matches) const
+{
+  sqlite3_stmt* stmt = db_conn->prepareStatement(
+      SQLLoader::getQuery(Query::UPDATE_FIXTURE_RESULT));
+  for (const auto& match : matches)
+  {
+    if (!match.isPlayed()) continue;
+
+    sqlite3_bind_int(stmt, 1, match.getHomeScore());
+    sqlite3_bind_int(stmt, 2, match.getAwayScore());
+    sqlite3_bind_text(stmt, 3, match.getDate().toString().c_str(), -1,
+                      SQLITE_TRANSIENT);
+    sqlite3_bind_int(stmt, 4, match.getHomeTeamId());
+    sqlite3_bind_int(stmt, 5, match.getAwayTeamId());
+
+    db_conn->executeStep(stmt);
+    sqlite3_reset(stmt);
+  }
+  sqlite3_finalize(stmt);
 }
 
 void FixtureRepository::loadCalendar(Calendar& calendar) const
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "database/database_connection.h"
@@ -47,6 +48,13 @@ class FixtureRepository
    */
   void saveCalendar(const Calendar& calendar) const;
 
+  /**
+   * @brief Write the results of the played matches among @p matches to their
+   * fixtures, with one prepared statement for the whole batch.
+   * @param matches Matches whose fixtures are already saved.
+   */
+  void saveResults(std::span<const Match> matches) const;
+
   /**
    * @brief Load the calendar from the database.
    * @param calendar The Calendar object to populate.
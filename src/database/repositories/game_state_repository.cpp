@@ -82,3 +82,50 @@ bool GameStateRepository::loadGameState(uint8_t& current_season,
   sqlite3_finalize(stmt);
   return has_data;
 }
+
+void GameStateRepository::saveRandomState(const RandomService& random) const
+{
+  sqlite3_stmt* stmt = db_conn->prepareStatement(
+      SQLLoader::getQuery(Query::UPSERT_RANDOM_STREAM));
+
+  for (uint8_t id = 0; id < RandomService::STREAM_COUNT; ++id)
+  {
+    const RandomStream& stream =
+        random.stream(static_cast<RandomService::Stream>(id));
+    sqlite3_bind_int(stmt, 1, id);
+    sqlite3_bind_int64(stmt, 2, static_cast<sqlite3_int64>(random.getSeed()));
+    sqlite3_bind_int64(stmt, 3,
+                       static_cast<sqlite3_int64>(stream.getPosition()));
+    db_conn->executeStep(stmt);
+    sqlite3_reset(stmt);
+  }
+  sqlite3_finalize(stmt);
+}
+
+bool GameStateRepository::loadRandomState(RandomService& random) const
+{
+  sqlite3_stmt* stmt;
+  if (const std::string& sql =
+          SQLLoader::getQuery(Query::SELECT_RANDOM_STREAMS);
+      sqlite3_prepare_v2(db_conn->getRaw(), sql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK)
+  {
+    return false;  // Saved before the streams were
+  }
+
+  bool has_data = false;
+  while (sqlite3_step(stmt) == SQLITE_ROW)
+  {
+    const int id = sqlite3_column_int(stmt, 0);
+    if (id < 0 || id >= RandomService::STREAM_COUNT) continue;
+
+    const auto seed = static_cast<uint64_t>(sqlite3_column_int64(stmt, 1));
+    if (!has_data) random.reseed(seed);
+    has_data = true;
+    random.restore(static_cast<RandomService::Stream>(id),
+                   static_cast<uint64_t>(sqlite3_column_int64(stmt, 2)));
+  }
+
+  sqlite3_finalize(stmt);
+  return has_data;
+}
@@ -13,6 +13,7 @@
 #include <string>
 
 #include "database/database_connection.h"
+#include "global/random_service.h"
 
 /**
  * @class GameStateRepository
@@ -52,6 +53,17 @@ class GameStateRepository
   bool loadGameState(uint8_t& current_season, uint16_t& managed_team_id,
                      std::string& game_date) const;
 
+  /**
+   * @brief Save the seed and the position of every stream of @p random.
+   */
+  void saveRandomState(const RandomService& random) const;
+
+  /**
+   * @brief Restore @p random to the saved seed and stream positions.
+   * @return True if a saved state was found, false otherwise.
+   */
+  bool loadRandomState(RandomService& random) const;
+
  private:
   std::shared_ptr<DatabaseConnection> db_conn;
 };
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "heatmap_repository.h"
+
+#include <sqlite3.h>
+
+#include "database/SQLLoader.h"
+
+HeatmapRepository::HeatmapRepository(std::shared_ptr<DatabaseConnection> conn)
+    : db_conn(conn)
+{
+}
+
+void HeatmapRepository::saveSeason(
+    uint8_t season,
+    const std::unordered_map<PlayerID, SeasonHeatmap>& heatmaps) const
+{
+  sqlite3_stmt* stmt = db_conn->prepareStatement(
+      SQLLoader::getQuery(Query::UPSERT_PLAYER_HEATMAP));
+
+  for (const auto& [playerId, heatmap] : heatmaps)
+  {
+    const std::vector<uint8_t> data = heatmap.encode();
+    sqlite3_bind_int(stmt, 1, season);
+    sqlite3_bind_int64(stmt, 2, playerId);
+    sqlite3_bind_blob(stmt, 3, data.data(), static_cast<int>(data.size()),
+                      SQLITE_TRANSIENT);
+
+    db_conn->executeStep(stmt);
+
+    sqlite3_clear_bindings(stmt);
+    sqlite3_reset(stmt);
+  }
+
+  sqlite3_finalize(stmt);
+}
+
+std::unordered_map<PlayerID, SeasonHeatmap> HeatmapRepository::loadSeason(
+    uint8_t season) const
+{
+  sqlite3_stmt* stmt = db_conn->prepareStatement(
+      SQLLoader::getQuery(Query::SELECT_PLAYER_HEATMAPS_BY_SEASON));
+
+  sqlite3_bind_int(stmt, 1, season);
+
+  std::unordered_map<PlayerID, SeasonHeatmap> heatmaps;
+  while (sqlite3_step(stmt) == SQLITE_ROW)
+  {
+    const auto playerId = static_cast<PlayerID>(sqlite3_column_int64(stmt, 0));
+    const auto* data =
+        static_cast<const uint8_t*>(sqlite3_column_blob(stmt, 1));
+    const auto size = static_cast<size_t>(sqlite3_column_bytes(stmt, 1));
+    if (auto heatmap = SeasonHeatmap::decode({data, size}))
+    {
+      heatmaps.emplace(playerId, *heatmap);
+    }
+  }
+
+  sqlite3_finalize(stmt);
+  return heatmaps;
+}
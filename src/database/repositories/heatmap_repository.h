@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "database/database_connection.h"
+#include "global/types.h"
+#include "model/match_heatmap.h"
+
+/**
+ * @class HeatmapRepository
+ * @brief Repository class for the season heatmaps of the players, stored
+ * encoded as one blob per player and season.
+ */
+class HeatmapRepository
+{
+ public:
+  /**
+   * @brief Construct a new Heatmap Repository object.
+   * @param db_conn Shared pointer to the database connection.
+   */
+  explicit HeatmapRepository(std::shared_ptr<DatabaseConnection> db_conn);
+
+  /**
+   * @brief Save the heatmaps of a season, replacing the stored ones.
+   * @param season The season the heatmaps belong to.
+   * @param heatmaps Heatmap of each player with tracked matches.
+   */
+  void saveSeason(uint8_t season,
+                  const std::unordered_map<PlayerID, SeasonHeatmap>& heatmaps)
+      const;
+
+  /**
+   * @brief Load the heatmaps of a season. Malformed blobs are skipped.
+   * @param season The season to load.
+   * @return Heatmap of each player with tracked matches.
+   */
+  std::unordered_map<PlayerID, SeasonHeatmap> loadSeason(uint8_t season) const;
+
+ private:
+  std::shared_ptr<DatabaseConnection> db_conn;
+};
@@ -0,0 +1,194 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+// Headless season simulator: runs whole seasons without the GUI and reports
+// where the time goes, for soak and throughput testing.
+
+#include <fmt/core.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "controller/game_controller.h"
+#include "global/logger.h"
+#include "model/game.h"
+#include "model/game_timings.h"
+
+namespace
+{
+struct Options
+{
+  std::string save_path = "fm_sim.db";
+  bool load = false;
+  int seasons = 1;
+  std::optional<uint64_t> seed;
+  std::optional<SimulationTier> tier;
+  bool tiered = false;
+};
+
+void printUsage()
+{
+  std::cout
+      << "Usage: fm_sim [options]\n"
+         "  --save PATH     Save file to create, or to load (fm_sim.db)\n"
+         "  --load          Continue the save instead of starting a new game\n"
+         "  --seasons N     Seasons to simulate (1)\n"
+         "  --seed S        Seed of a new game (1), or reseeds a loaded one\n"
+         "  --tier T        statistical, reduced or full for every fixture\n"
+         "  --tiered        Tier fixtures by closeness to the managed team\n";
+}
+
+std::optional<SimulationTier> parseTier(const std::string& name)
+{
+  if (name == "statistical") return SimulationTier::STATISTICAL;
+  if (name == "reduced") return SimulationTier::REDUCED_PHYSICS;
+  if (name == "full") return SimulationTier::FULL_PHYSICS;
+  return std::nullopt;
+}
+
+std::optional<Options> parseOptions(int argc, char** argv)
+{
+  Options options;
+  try
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+      const bool has_value = i + 1 < argc;
+      if (arg == "--load")
+      {
+        options.load = true;
+      }
+      else if (arg == "--tiered")
+      {
+        options.tiered = true;
+      }
+      else if (arg == "--save" && has_value)
+      {
+        options.save_path = argv[++i];
+      }
+      else if (arg == "--seasons" && has_value)
+      {
+        options.seasons = std::stoi(argv[++i]);
+      }
+      else if (arg == "--seed" && has_value)
+      {
+        options.seed = std::stoull(argv[++i]);
+      }
+      else if (arg == "--tier" && has_value)
+      {
+        options.tier = parseTier(argv[++i]);
+        if (!options.tier) return std::nullopt;
+      }
+      else
+      {
+        return std::nullopt;
+      }
+    }
+  }
+  catch (const std::logic_error&)
+  {
+    return std::nullopt;  // Not a number
+  }
+  if (options.seasons < 1) return std::nullopt;
+  return options;
+}
+
+void printReport(const GameTimings& timings, int days, double total)
+{
+  static constexpr const char* PHASE_NAMES[GameTimings::PHASE_COUNT] = {
+      "matches", "training", "AI transfers", "persistence", "season rollover"};
+
+  fmt::print("\n{:<16} {:>10} {:>7}\n", "phase", "seconds", "share");
+  double timed = 0.0;
+  for (size_t p = 0; p < GameTimings::PHASE_COUNT; ++p)
+  {
+    const double seconds = timings.seconds(static_cast<GameTimings::Phase>(p));
+    timed += seconds;
+    fmt::print("{:<16} {:>10.3f} {:>6.1f}%\n", PHASE_NAMES[p], seconds,
+               100.0 * seconds / total);
+  }
+  fmt::print("{:<16} {:>10.3f} {:>6.1f}%\n", "other", total - timed,
+             100.0 * (total - timed) / total);
+  fmt::print("\n{} days in {:.3f} s: {:.1f} simulated days per second\n", days,
+             total, days / total);
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const std::optional<Options> options = parseOptions(argc, argv);
+  if (!options)
+  {
+    printUsage();
+    return 2;
+  }
+
+  Logger::init();
+  try
+  {
+    GameController controller;
+    if (options->load)
+    {
+      if (!controller.loadGameAt(options->save_path))
+      {
+        std::cerr << "No save at " << options->save_path << "\n";
+        return 1;
+      }
+    }
+    else
+    {
+      controller.newGameAt(options->save_path, options->seed.value_or(1));
+    }
+
+    Game& game = *controller.getGame();
+    if (options->load && options->seed) game.setSeed(*options->seed);
+    game.setSimulationTierOverride(options->tier);
+    game.setTieredSimulation(options->tiered);
+    // Nobody plays the managed team's matches here
+    game.setManagedFixturesDeferred(false);
+
+    // Loading and generating the world is not part of the run
+    game.getTimings() = {};
+    using Clock = GameTimings::Clock;
+    const auto start = Clock::now();
+    int days = 0;
+    for (int s = 0; s < options->seasons; ++s)
+    {
+      const auto season_start = Clock::now();
+      const int season = controller.getCurrentSeason();
+      int season_days = 0;
+      // A managed team in a loaded save still stops the run on its matchdays
+      while (controller.getCurrentSeason() == season)
+      {
+        season_days += controller.advanceUntil(
+            GameController::AdvanceTarget::SEASON_END);
+      }
+      controller.saveGame();
+      days += season_days;
+
+      const std::chrono::duration<double> elapsed =
+          Clock::now() - season_start;
+      fmt::print("season {}: {} days in {:.3f} s\n", season, season_days,
+                 elapsed.count());
+    }
+
+    const std::chrono::duration<double> total = Clock::now() - start;
+    printReport(game.getTimings(), days, total.count());
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -38,12 +38,16 @@ enum class Query
   DELETE_ALL_FIXTURES,
   UPSERT_GAME_STATE,
   SELECT_GAME_STATE,
+  UPSERT_RANDOM_STREAM,
+  SELECT_RANDOM_STREAMS,
   UPSERT_LEAGUE_POINTS,
   SELECT_LEAGUE_POINTS,
   RESET_ALL_LEAGUE_POINTS,
   UPSERT_TRANSFER_LISTING,
   DELETE_TRANSFER_LISTING,
   LOAD_ALL_TRANSFER_LISTINGS,
+  UPSERT_PLAYER_HEATMAP,
+  SELECT_PLAYER_HEATMAPS_BY_SEASON,
   COUNT /*!< Total number of queries, useful for array sizing */
 };
 
@@ -90,6 +94,8 @@ const std::unordered_map<std::string, Query> string_to_query_map = {
     // Game State
     {"UPSERT_GAME_STATE", Query::UPSERT_GAME_STATE},
     {"SELECT_GAME_STATE", Query::SELECT_GAME_STATE},
+    {"UPSERT_RANDOM_STREAM", Query::UPSERT_RANDOM_STREAM},
+    {"SELECT_RANDOM_STREAMS", Query::SELECT_RANDOM_STREAMS},
 
     // League Points
     {"UPSERT_LEAGUE_POINTS", Query::UPSERT_LEAGUE_POINTS},
@@ -100,4 +106,9 @@ const std::unordered_map<std::string, Query> string_to_query_map = {
     {"UPSERT_TRANSFER_LISTING", Query::UPSERT_TRANSFER_LISTING},
     {"DELETE_TRANSFER_LISTING", Query::DELETE_TRANSFER_LISTING},
     {"LOAD_ALL_TRANSFER_LISTINGS", Query::LOAD_ALL_TRANSFER_LISTINGS},
+
+    // Player Heatmaps
+    {"UPSERT_PLAYER_HEATMAP", Query::UPSERT_PLAYER_HEATMAP},
+    {"SELECT_PLAYER_HEATMAPS_BY_SEASON",
+     Query::SELECT_PLAYER_HEATMAPS_BY_SEASON},
 };
@@ -0,0 +1,26 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "global/random_service.h"
+
+#include <random>
+
+void RandomService::reseed(uint64_t new_seed)
+{
+  seed = new_seed;
+  for (size_t id = 0; id < streams.size(); ++id)
+  {
+    streams[id].reseed(seed, id);
+  }
+}
+
+uint64_t RandomService::freshSeed()
+{
+  std::random_device rd;
+  return (uint64_t{rd()} << 32) | rd();
+}
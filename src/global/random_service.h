@@ -0,0 +1,61 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "global/random_stream.h"
+
+/**
+ * @class RandomService
+ * @brief The randomness of a game: one RandomStream per subsystem, all
+ * derived from the seed saved with the game.
+ *
+ * Streams are counter based, so a seed and the number of values each stream
+ * has drawn are their whole state. Both are saved with the game, and a
+ * loaded game draws exactly what the original would have, which makes whole
+ * seasons reproducible. Subsystems draw from their own stream, so adding a
+ * draw to one does not shift the numbers of another.
+ *
+ * Work spread over threads does not share a stream: it derives its own from
+ * the seed and a task id, e.g. MatchSimulator seeds per fixture.
+ */
+class RandomService
+{
+ public:
+  enum Stream : uint8_t
+  {
+    GENERATION, /*!< Players of a new world */
+    TRAINING,
+    RETIREMENT,
+    TRANSFERS, /*!< AI market decisions */
+    STREAM_COUNT
+  };
+
+  explicit RandomService(uint64_t seed = 0) { reseed(seed); }
+
+  /** @brief Restarts every stream from @p seed. */
+  void reseed(uint64_t seed);
+
+  uint64_t getSeed() const { return seed; }
+
+  RandomStream& stream(Stream id) { return streams[id]; }
+  const RandomStream& stream(Stream id) const { return streams[id]; }
+
+  /** @brief Moves a stream to a saved position, see RandomStream::seek(). */
+  void restore(Stream id, uint64_t position) { streams[id].seek(position); }
+
+  /** @brief A seed from the system, drawn once per new game. */
+  static uint64_t freshSeed();
+
+ private:
+  uint64_t seed = 0;
+  std::array<RandomStream, STREAM_COUNT> streams;
+};
@@ -0,0 +1,165 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class RandomStream
+ * @brief Counter-based random number stream (Philox4x32-10).
+ *
+ * Every value is a pure function of (seed, stream, position), so streams hold
+ * no hidden shared state: two streams with different ids never overlap and
+ * can be used from different threads, and any stream can be recreated from
+ * its seed and id to replay a sequence. split() derives independent child
+ * streams, e.g. one per match and then one per engine subsystem.
+ *
+ * Satisfies UniformRandomBitGenerator, but uniform() should be preferred in
+ * simulation code since standard distributions differ between library
+ * implementations.
+ */
+class RandomStream
+{
+ public:
+  using result_type = uint32_t;
+
+  explicit RandomStream(uint64_t seed = 0, uint64_t stream = 0)
+  {
+    reseed(seed, stream);
+  }
+
+  /**
+   * @brief Restarts the stream at the beginning of the given sequence.
+   * @param seed Key shared by all streams of a simulation.
+   * @param stream Identifier of the sequence within that key.
+   */
+  void reseed(uint64_t seed, uint64_t stream = 0)
+  {
+    key_ = seed;
+    stream_ = stream;
+    block_ = 0;
+    index_ = BLOCK_SIZE;
+  }
+
+  /**
+   * @brief Derives an independent stream sharing this stream's seed.
+   * @param substream Identifier of the child, e.g. a subsystem or fixture.
+   */
+  [[nodiscard]] RandomStream split(uint64_t substream) const
+  {
+    return RandomStream(key_, mix(stream_ ^ mix(substream + 1)));
+  }
+
+  uint64_t getSeed() const { return key_; }
+  uint64_t getStream() const { return stream_; }
+
+  /** @brief Number of values drawn since the stream was (re)seeded. */
+  uint64_t getPosition() const
+  {
+    return index_ == BLOCK_SIZE ? block_ * BLOCK_SIZE
+                                : (block_ - 1) * BLOCK_SIZE + index_;
+  }
+
+  /**
+   * @brief Jumps to @p position values from the start of the sequence, in
+   * constant time. Together with the seed and stream id this restores any
+   * saved stream state.
+   */
+  void seek(uint64_t position)
+  {
+    block_ = position / BLOCK_SIZE;
+    index_ = BLOCK_SIZE;
+    if (const size_t offset = position % BLOCK_SIZE; offset != 0)
+    {
+      buffer_ = generateBlock(block_++);
+      index_ = offset;
+    }
+  }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max()
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()()
+  {
+    if (index_ == BLOCK_SIZE)
+    {
+      buffer_ = generateBlock(block_++);
+      index_ = 0;
+    }
+    return buffer_[index_++];
+  }
+
+  /** @brief Uniform float in [0, 1), identical on every platform. */
+  float uniform()
+  {
+    // 24 random bits fill the float mantissa exactly
+    return static_cast<float>((*this)() >> 8) * 0x1.0p-24f;
+  }
+
+  /** @brief Uniform float in [lo, hi). */
+  float uniform(float lo, float hi) { return lo + (hi - lo) * uniform(); }
+
+  /** @brief Integer in [0, n), identical on every platform. */
+  uint32_t below(uint32_t n)
+  {
+    // Multiply-shift: the bias is at most n / 2^32, far below anything a
+    // game can notice, and it needs neither a division nor a retry
+    return static_cast<uint32_t>((static_cast<uint64_t>((*this)()) * n) >> 32);
+  }
+
+ private:
+  static constexpr size_t BLOCK_SIZE = 4;
+  static constexpr int ROUNDS = 10;
+  static constexpr uint32_t MULT_0 = 0xD2511F53u;
+  static constexpr uint32_t MULT_1 = 0xCD9E8D57u;
+  static constexpr uint32_t WEYL_0 = 0x9E3779B9u;
+  static constexpr uint32_t WEYL_1 = 0xBB67AE85u;
+
+  uint64_t key_ = 0;
+  uint64_t stream_ = 0;
+  uint64_t block_ = 0;
+  std::array<uint32_t, BLOCK_SIZE> buffer_{};
+  size_t index_ = BLOCK_SIZE;
+
+  /** @brief SplitMix64 finalizer, spreads stream ids over the whole range. */
+  static constexpr uint64_t mix(uint64_t z)
+  {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  std::array<uint32_t, BLOCK_SIZE> generateBlock(uint64_t block) const
+  {
+    std::array<uint32_t, BLOCK_SIZE> c = {
+        static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32),
+        static_cast<uint32_t>(stream_), static_cast<uint32_t>(stream_ >> 32)};
+    uint32_t k0 = static_cast<uint32_t>(key_);
+    uint32_t k1 = static_cast<uint32_t>(key_ >> 32);
+
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+      const uint64_t p0 = static_cast<uint64_t>(MULT_0) * c[0];
+      const uint64_t p1 = static_cast<uint64_t>(MULT_1) * c[2];
+      c = {static_cast<uint32_t>(p1 >> 32) ^ c[1] ^ k0,
+           static_cast<uint32_t>(p1),
+           static_cast<uint32_t>(p0 >> 32) ^ c[3] ^ k1,
+           static_cast<uint32_t>(p0)};
+      k0 += WEYL_0;
+      k1 += WEYL_1;
+    }
+    return c;
+  }
+};
@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "thread_pool.h"
+
+namespace
+{
+// Identifies the pool and queue owned by the current thread, if any
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_index = 0;
+}  // namespace
+
+ThreadPool::ThreadPool(size_t thread_count)
+{
+  thread_count = std::max<size_t>(thread_count, 1);
+  queues.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    queues.push_back(std::make_unique<WorkerQueue>());
+  }
+  workers.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    workers.emplace_back([this, i]() { workerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::scoped_lock lock(wake_mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::defaultThreadCount()
+{
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+ThreadPool& ThreadPool::shared()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+size_t ThreadPool::currentWorker() const
+{
+  return current_pool == this ? current_index : queues.size();
+}
+
+void ThreadPool::push(Task task)
+{
+  size_t target = currentWorker();
+  if (target == queues.size())
+  {
+    target = next_queue++ % queues.size();
+  }
+
+  // Count the task before it becomes visible, so a thief can never take it
+  // while pending is still zero
+  {
+    std::scoped_lock lock(wake_mutex);
+    ++pending;
+  }
+  {
+    std::scoped_lock lock(queues[target]->mutex);
+    queues[target]->tasks.push_back(std::move(task));
+  }
+  wake.notify_one();
+}
+
+bool ThreadPool::tryRunOne(size_t preferred)
+{
+  Task task;
+
+  // Own queue first, newest task (still warm in cache)
+  if (preferred < queues.size())
+  {
+    WorkerQueue& own = *queues[preferred];
+    std::scoped_lock lock(own.mutex);
+    if (!own.tasks.empty())
+    {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+    }
+  }
+
+  // Then steal the oldest task of another queue
+  for (size_t offset = 1; !task && offset <= queues.size(); ++offset)
+  {
+    WorkerQueue& victim = *queues[(preferred + offset) % queues.size()];
+    std::scoped_lock lock(victim.mutex);
+    if (!victim.tasks.empty())
+    {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+    }
+  }
+
+  if (!task) return false;
+
+  {
+    std::scoped_lock lock(wake_mutex);
+    --pending;
+  }
+  task();
+  return true;
+}
+
+void ThreadPool::workerLoop(size_t index)
+{
+  current_pool = this;
+  current_index = index;
+
+  while (true)
+  {
+    if (tryRunOne(index)) continue;
+
+    std::unique_lock lock(wake_mutex);
+    wake.wait(lock, [this]() { return stopping || pending > 0; });
+    if (stopping && pending == 0) return;
+  }
+}
@@ -0,0 +1,170 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size work-stealing thread pool.
+ *
+ * Every worker owns a task deque. Tasks submitted from a worker go to the
+ * back of its own deque and are taken LIFO; tasks submitted from any other
+ * thread are spread round-robin. A worker that runs out of work steals from
+ * the front of the other deques.
+ *
+ * The caller of parallelFor works through its own range and then only waits
+ * for helpers already inside that range, never running other queued tasks
+ * (a UI thread must not pick up a whole background job). Helpers never wait
+ * on queued work, so nested use from inside a task cannot deadlock.
+ */
+class ThreadPool
+{
+ public:
+  /**
+   * @brief Starts the worker threads.
+   * @param thread_count Number of workers, at least 1.
+   */
+  explicit ThreadPool(size_t thread_count = defaultThreadCount());
+
+  /** @brief Finishes every queued task, then joins the workers. */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /** @brief Number of worker threads. */
+  size_t size() const { return workers.size(); }
+
+  /** @brief Hardware concurrency, or 1 if it cannot be determined. */
+  static size_t defaultThreadCount();
+
+  /** @brief Process-wide pool sized to the hardware, created on first use. */
+  static ThreadPool& shared();
+
+  /**
+   * @brief Queues a task.
+   * @return A future holding the task's result or exception.
+   */
+  template <typename F>
+  auto submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+  {
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(
+        std::forward<F>(task));
+    std::future<Result> result = packaged->get_future();
+    push([packaged]() { (*packaged)(); });
+    return result;
+  }
+
+  /**
+   * @brief Runs body(i) for every i in [0, count) and waits for all of them.
+   *
+   * Indices are handed out dynamically, so uneven work balances across
+   * threads. The calling thread takes part in the work. The first exception
+   * thrown by body is rethrown here once every started call has returned.
+   */
+  template <typename F>
+  void parallelFor(size_t count, F&& body);
+
+ private:
+  using Task = std::function<void()>;
+
+  struct WorkerQueue
+  {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues;
+  std::vector<std::thread> workers;
+
+  std::mutex wake_mutex;
+  std::condition_variable wake;
+  size_t pending = 0;  // Guarded by wake_mutex
+  bool stopping = false;
+  std::atomic<size_t> next_queue{0};
+
+  void push(Task task);
+  bool tryRunOne(size_t preferred);
+  void workerLoop(size_t index);
+
+  /** @brief Index of the calling thread in this pool, or size() if none. */
+  size_t currentWorker() const;
+};
+
+template <typename F>
+void ThreadPool::parallelFor(size_t count, F&& body)
+{
+  if (count == 0) return;
+
+  struct Shared
+  {
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> running{0};  // Helpers inside the range
+    std::mutex error_mutex;
+    std::exception_ptr error;
+  };
+  auto state = std::make_shared<Shared>();
+
+  auto drain = [state, &body, count]()
+  {
+    for (size_t i = state->next++; i < count; i = state->next++)
+    {
+      try
+      {
+        body(i);
+      }
+      catch (...)
+      {
+        std::scoped_lock lock(state->error_mutex);
+        if (!state->error) state->error = std::current_exception();
+      }
+    }
+  };
+
+  // One helper per worker at most, the caller covers the rest
+  const size_t helpers = std::min(count - 1, size());
+  for (size_t h = 0; h < helpers; ++h)
+  {
+    push(
+        [state, drain, count]()
+        {
+          // Enter before checking for work left: a caller that has drained
+          // the range and then sees no helper running can return, as any
+          // later helper finds the range closed without touching body
+          state->running++;
+          if (state->next < count) drain();
+          if (--state->running == 0) state->running.notify_all();
+        });
+  }
+
+  drain();
+
+  // Every index is handed out; wait only for calls still running
+  for (size_t n = state->running; n > 0; n = state->running)
+  {
+    state->running.wait(n);
+  }
+
+  if (state->error) std::rethrow_exception(state->error);
+}
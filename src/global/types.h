@@ -83,4 +83,6 @@ struct Vector2F
 {
   float x;
   float y;
+
+  bool operator==(const Vector2F&) const = default;
 };
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "gui/scenes/team_selection_scene.h"
 #include "gui/scenes/transfer_market_scene.h"
 #include "model/game.h"
+#include "model/match_predictor.h"
 #include "model/role_utils.h"
 
 namespace
@@ -32,6 +33,7 @@ constexpr float NEXT_DAY_BUTTON_WIDTH = 150.0f;
 constexpr float NEXT_DAY_BUTTON_HEIGHT = 30.0f;
 constexpr float NEXT_DAY_BUTTON_OFFSET = 160.0f;
 constexpr float SIDEBAR_BUTTON_HEIGHT = 40.0f;
+constexpr float PREDICTION_SPACING = 30.0f;
 constexpr int STANDINGS_COLUMNS = 3;
 constexpr int TOP_PLAYERS_COLUMNS = 3;
 constexpr float POS_COL_WIDTH = 30.0f;
@@ -89,7 +91,25 @@ void MainGameScene::renderTopBar()
 {
   std::string dateStr = guiView->getController().getCurrentDate().toString();
   ImGui::Text(LOC("MAIN_GAME_DATE"), dateStr.c_str());
-  ImGui::SameLine(ImGui::GetWindowWidth() - NEXT_DAY_BUTTON_OFFSET);
+
+  // Outcome estimate of the next fixture, refined while runs complete
+  MatchPrediction prediction =
+      guiView->getController().getNextFixturePrediction();
+  if (prediction.completedRuns > 0)
+  {
+    ImGui::SameLine(0.0f, PREDICTION_SPACING);
+    ImGui::Text(LOC("PREDICTION_OUTCOME"), prediction.homeWin * 100.0f,
+                prediction.draw * 100.0f, prediction.awayWin * 100.0f);
+    ImGui::SameLine(0.0f, PREDICTION_SPACING);
+    ImGui::Text(LOC("PREDICTION_GOALS"), prediction.expectedHomeGoals,
+                prediction.expectedAwayGoals);
+    if (!prediction.isComplete())
+    {
+      ImGui::SameLine(0.0f, PREDICTION_SPACING);
+      ImGui::TextDisabled(LOC("PREDICTION_PROGRESS"), prediction.completedRuns,
+                          prediction.requestedRuns);
+    }
+  }
 
   // Check if managed team has a match today
   bool has_match_today = false;
@@ -102,7 +122,8 @@ void MainGameScene::renderTopBar()
             guiView->getController().getCurrentDate());
     for (const auto& m : matches)
     {
-      if (m.getHomeTeamId() == tid || m.getAwayTeamId() == tid)
+      if (!m.isPlayed() &&
+          (m.getHomeTeamId() == tid || m.getAwayTeamId() == tid))
       {
         has_match_today = true;
         opp_id =
@@ -114,6 +135,7 @@ void MainGameScene::renderTopBar()
 
   if (has_match_today)
   {
+    ImGui::SameLine(ImGui::GetWindowWidth() - NEXT_DAY_BUTTON_OFFSET);
     if (ImGui::Button("Play Match",
                       ImVec2(NEXT_DAY_BUTTON_WIDTH, NEXT_DAY_BUTTON_HEIGHT)))
     {
@@ -123,6 +145,16 @@ void MainGameScene::renderTopBar()
   }
   else
   {
+    // Runs every day up to the next fixture in one go
+    ImGui::SameLine(ImGui::GetWindowWidth() - 2.0f * NEXT_DAY_BUTTON_OFFSET);
+    if (ImGui::Button(LOC("MAIN_GAME_NEXT_MATCH"),
+                      ImVec2(NEXT_DAY_BUTTON_WIDTH, NEXT_DAY_BUTTON_HEIGHT)))
+    {
+      guiView->getController().advanceUntil(
+          GameController::AdvanceTarget::NEXT_MANAGED_FIXTURE);
+      refreshData();
+    }
+    ImGui::SameLine(ImGui::GetWindowWidth() - NEXT_DAY_BUTTON_OFFSET);
     if (ImGui::Button(LOC("MAIN_GAME_NEXT_DAY"),
                       ImVec2(NEXT_DAY_BUTTON_WIDTH, NEXT_DAY_BUTTON_HEIGHT)))
     {
@@ -258,6 +290,7 @@ void MainGameScene::refreshData()
 {
   cached_date = guiView->getController().getCurrentDate();
   cached_season = guiView->getController().getCurrentSeason();
+  guiView->getController().predictNextFixture();
 
   auto managedTeamOpt = guiView->getController().getManagedTeam();
   if (!managedTeamOpt.has_value()) return;
@@ -10,9 +10,13 @@
 
 #include <imgui.h>
 
+#include <algorithm>
+#include <chrono>
 #include <format>
 #include <numbers>
 
+#include "database/gamedata.h"
+#include "global/thread_pool.h"
 #include "gui/gui_view.h"
 #include "model/role_utils.h"
 #include "model/team.h"
@@ -22,6 +26,17 @@ MatchScene::MatchScene(GUIView* guiView_ptr, uint16_t home_id, uint16_t away_id)
 {
 }
 
+MatchScene::~MatchScene()
+{
+  // The worker reads players owned by the game data, do not outlive it
+  if (skip_job)
+  {
+    skip_job->cancelled = true;
+    skip_done.wait();
+  }
+  if (what_if.valid()) what_if.wait();
+}
+
 SceneID MatchScene::getID() const
 {
   return SceneID::GAME_MENU; /* Re-use for now */
@@ -43,17 +58,44 @@ void MatchScene::onEnter()
     engine = std::make_unique<MatchEngine>(
         home_team.getLineup(), away_team.getLineup(), home_team.getStrategy(),
         away_team.getStrategy(), guiView->getController().getStatsConfig());
+    engine->setRecorder(&recorder);
+    heatmaps = &guiView->getController().acquireMatchHeatmaps();
+    engine->setHeatmaps(heatmaps);
   }
 }
 
 void MatchScene::update(float deltaTime)
 {
+  if (skip_job)
+  {
+    pollSkipToEnd();
+    return;
+  }
+
+  if (replay)
+  {
+    if (replay_playing)
+    {
+      // Same pace as live play, one simulated minute per second at 1x
+      replay_position += deltaTime * static_cast<float>(replay->getTickRate()) *
+                         match_speed;
+      const auto last = static_cast<float>(replay->getFrameCount() - 1);
+      if (replay_position >= last)
+      {
+        replay_position = last;
+        replay_playing = false;
+      }
+    }
+    return;
+  }
+
   if (engine && !match_finished && !is_paused)
   {
+    // The engine runs fixed ticks, so speed only changes how many run
     engine->update(deltaTime * match_speed);
-    if (engine->getMatchTimeMinutes() >= 90.0f)
+    if (engine->isFinished())
     {
-      match_finished = true;
+      onMatchFinished();
     }
   }
 }
@@ -78,31 +120,77 @@ void MatchScene::render()
     return;
   }
 
+  std::optional<ReplayFrame> replay_frame;
+  if (replay)
+  {
+    replay_frame = replay->frameAt(static_cast<uint32_t>(replay_position));
+  }
+  const int home_score =
+      replay_frame ? replay_frame->homeScore : engine->getHomeScore();
+  const int away_score =
+      replay_frame ? replay_frame->awayScore : engine->getAwayScore();
+  const float minutes = replay_frame ? replay_frame->timeMinute
+                                     : engine->getMatchTimeMinutes();
+
   // Scoreboard
   ImGui::SetWindowFontScale(1.5f);
-  ImGui::Text("%s %d - %d %s", home_name.c_str(), engine->getHomeScore(),
-              engine->getAwayScore(), away_name.c_str());
+  ImGui::Text("%s %d - %d %s", home_name.c_str(), home_score, away_score,
+              away_name.c_str());
   ImGui::SameLine(ImGui::GetWindowWidth() - 150.0f);
-  ImGui::Text("Time: %02d:%02d", (int)engine->getMatchTimeMinutes(),
-              (int)((engine->getMatchTimeMinutes() -
-                     (int)engine->getMatchTimeMinutes()) *
-                    60));
+  ImGui::Text("Time: %02d:%02d", (int)minutes,
+              (int)((minutes - (int)minutes) * 60));
   ImGui::SetWindowFontScale(1.0f);
 
-  if (ImGui::Button(is_paused ? "Resume" : "Pause", ImVec2(100, 30)))
+  if (replay)
   {
-    is_paused = !is_paused;
+    renderReplayControls();
   }
-  ImGui::SameLine();
-  ImGui::SetNextItemWidth(150.0f);
-  ImGui::SliderFloat("Speed", &match_speed, 0.5f, 5.0f, "%.1fx");
-  ImGui::SameLine();
-  if (ImGui::Button("Substitutions", ImVec2(120, 30)))
+  else if (skip_job)
   {
-    show_substitutions = true;
-    is_paused = true;  // Auto-pause when substituting
-    selected_pitch_player = 0;
-    selected_bench_player = 0;
+    const float minute = skip_job->minute;
+    std::string overlay = std::format("Simulating... {}'", (int)minute);
+    ImGui::ProgressBar(minute / MatchEngine::MATCH_LENGTH_MINUTES,
+                       ImVec2(400, 30), overlay.c_str());
+  }
+  else
+  {
+    if (ImGui::Button(is_paused ? "Resume" : "Pause", ImVec2(100, 30)))
+    {
+      is_paused = !is_paused;
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(150.0f);
+    ImGui::SliderFloat("Speed", &match_speed, 0.5f, 5.0f, "%.1fx");
+    ImGui::SameLine();
+    if (ImGui::Button("Substitutions", ImVec2(120, 30)))
+    {
+      show_substitutions = true;
+      is_paused = true;  // Auto-pause when substituting
+      selected_pitch_player = 0;
+      selected_bench_player = 0;
+    }
+    if (!match_finished)
+    {
+      ImGui::SameLine();
+      if (ImGui::Button("Skip to End", ImVec2(120, 30)))
+      {
+        startSkipToEnd();
+      }
+      ImGui::SameLine();
+      if (ImGui::Checkbox("Track Heatmaps", &track_heatmaps))
+      {
+        engine->setHeatmaps(track_heatmaps ? heatmaps : nullptr);
+      }
+    }
+    else
+    {
+      renderHeatmapControls();
+    }
+    if constexpr (MatchProfile::ENABLED)
+    {
+      ImGui::SameLine();
+      ImGui::Checkbox("Profile", &show_profile);
+    }
   }
 
   ImGui::Separator();
@@ -191,11 +279,45 @@ void MatchScene::render()
   draw_list->PathArcTo(ImVec2(p_max.x, p_max.y), corner_r, PI, PI * 1.5f, 10);
   draw_list->PathStroke(line_color, 0, 2.0f);
 
-  // Players
-  for (const auto& mp : engine->getPlayers())
+  // Heatmap, yellow to red with the time spent in each cell
+  if (show_heatmap && !replay_frame)
+  {
+    const float cell_w = pitch_width / PlayerHeatmap::COLUMNS;
+    const float cell_h = pitch_height / PlayerHeatmap::ROWS;
+    const auto intensity = heatmapIntensity();
+    for (size_t cell = 0; cell < intensity.size(); ++cell)
+    {
+      const float t = intensity[cell];
+      if (t <= 0.0f) continue;
+      auto min = ImVec2(p_min.x + cell_w * (cell % PlayerHeatmap::COLUMNS),
+                        p_min.y + cell_h * (cell / PlayerHeatmap::COLUMNS));
+      draw_list->AddRectFilled(
+          min, ImVec2(min.x + cell_w, min.y + cell_h),
+          IM_COL32(255, (int)(255 * (1.0f - t)), 0, (int)(60 + 160 * t)));
+    }
+  }
+
+  // Players, interpolated between the last two fixed ticks
+  const auto& players = engine->getPlayers();
+  if (replay_frame)
   {
-    auto pos = ImVec2(p_min.x + mp.position.x * pitch_width,
-                      p_min.y + mp.position.y * pitch_height);
+    for (size_t i = 0; i < replay->getSlotCount(); ++i)
+    {
+      Vector2F mpos = replay_frame->players[i];
+      auto pos = ImVec2(p_min.x + mpos.x * pitch_width,
+                        p_min.y + mpos.y * pitch_height);
+      draw_list->AddCircleFilled(pos, 8.0f,
+                                 replay->isHomeSlot(i)
+                                     ? IM_COL32(50, 50, 200, 255)
+                                     : IM_COL32(200, 50, 50, 255));
+    }
+  }
+  for (size_t i = 0; !replay_frame && i < players.size(); ++i)
+  {
+    const MatchPlayer& mp = players[i];
+    Vector2F mpos = engine->interpolatedPlayerPosition(i);
+    auto pos = ImVec2(p_min.x + mpos.x * pitch_width,
+                      p_min.y + mpos.y * pitch_height);
     ImU32 color =
         mp.isHomeTeam ? IM_COL32(50, 50, 200, 255) : IM_COL32(200, 50, 50, 255);
     draw_list->AddCircleFilled(pos, 8.0f, color);
@@ -210,7 +332,8 @@ void MatchScene::render()
   }
 
   // Ball
-  Vector2F bpos = engine->getBall().position;
+  Vector2F bpos =
+      replay_frame ? replay_frame->ball : engine->interpolatedBallPosition();
   auto ball_pos =
       ImVec2(p_min.x + bpos.x * pitch_width, p_min.y + bpos.y * pitch_height);
   draw_list->AddCircleFilled(ball_pos, 4.0f, IM_COL32(255, 255, 255, 255));
@@ -219,11 +342,22 @@ void MatchScene::render()
 
   ImGui::Separator();
 
-  // Events Log
+  // Events Log, up to the replayed tick while watching the replay
   ImGui::BeginChild("Events", ImVec2(0, 150), true);
-  for (const auto& ev : engine->getEvents())
+  const auto& events = engine->getEvents();
+  size_t end = events.size();
+  if (replay)
+  {
+    const auto tick = static_cast<uint32_t>(replay_position);
+    end = static_cast<size_t>(
+        std::ranges::upper_bound(events, tick, {}, &MatchEvent::tick) -
+        events.begin());
+  }
+  const size_t first = end > VISIBLE_EVENTS ? end - VISIBLE_EVENTS : 0;
+  for (size_t i = first; i < end; ++i)
   {
-    ImGui::Text("[%02d'] %s", (int)ev.timeMinute, ev.description.c_str());
+    ImGui::Text("[%02d'] %s", (int)events[i].timeMinute,
+                describeEvent(events[i]).c_str());
   }
   // Auto-scroll
   if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
@@ -232,17 +366,258 @@ void MatchScene::render()
 
   if (match_finished && ImGui::Button("Finish Match", ImVec2(150, 40)))
   {
-    guiView->getController().setMatchResult(
-        guiView->getController().getCurrentDate(), home_team_id, away_team_id,
-        engine->getHomeScore(), engine->getAwayScore());
-    guiView->popScene();  // Pop MatchScene
-    // Also advance day now that match is watched
-    guiView->getController().advanceDay();
+    leaveMatch();
+  }
+  if (match_finished && !replay && !replay_path.empty())
+  {
+    ImGui::SameLine();
+    if (ImGui::Button("Watch Replay", ImVec2(150, 40)))
+    {
+      replay = MatchReplay::load(replay_path);
+      replay_position = 0.0f;
+      replay_playing = replay.has_value();
+    }
+  }
+
+  ImGui::End();
+
+  if (show_profile) renderProfileOverlay();
+}
+
+void MatchScene::renderProfileOverlay()
+{
+  const MatchProfile& profile = engine->getProfile();
+
+  ImGui::SetNextWindowBgAlpha(0.75f);
+  ImGui::Begin("Engine Profile", &show_profile,
+               ImGuiWindowFlags_AlwaysAutoResize |
+                   ImGuiWindowFlags_NoFocusOnAppearing);
+
+  static constexpr const char* PHASES[] = {"Forces", "Possession", "Goals"};
+  double total = 0.0;
+  for (size_t p = 0; p < MatchProfile::PHASE_COUNT; ++p)
+  {
+    total += profile.cyclesPerTick(static_cast<MatchProfile::Phase>(p));
+  }
+  ImGui::Text("%u ticks", profile.ticks);
+  if (ImGui::BeginTable("Phases", 3, ImGuiTableFlags_RowBg))
+  {
+    ImGui::TableSetupColumn("Phase");
+    ImGui::TableSetupColumn("Cycles/tick");
+    ImGui::TableSetupColumn("Share");
+    ImGui::TableHeadersRow();
+    for (size_t p = 0; p < MatchProfile::PHASE_COUNT; ++p)
+    {
+      const double cycles =
+          profile.cyclesPerTick(static_cast<MatchProfile::Phase>(p));
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(PHASES[p]);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.0f", cycles);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f%%", total > 0.0 ? 100.0 * cycles / total : 0.0);
+    }
+    ImGui::EndTable();
   }
 
+  ImGui::Separator();
+  ImGui::Text("Possession changes: %u",
+              profile.events[MatchProfile::POSSESSION_CHANGE]);
+  ImGui::Text("Passes: %u", profile.events[MatchProfile::PASS]);
+  ImGui::Text("Tackles: %u", profile.events[MatchProfile::TACKLE]);
+  ImGui::Text("Goal resets: %u", profile.events[MatchProfile::GOAL_RESET]);
   ImGui::End();
 }
 
+void MatchScene::startSkipToEnd()
+{
+  show_substitutions = false;
+  skip_job = std::make_shared<SkipJob>(*engine);
+  skip_done = ThreadPool::shared().submit(
+      [job = skip_job]()
+      {
+        job->engine.simulateRemaining(
+            [&state = *job](float minute)
+            {
+              state.minute = minute;
+              return !state.cancelled;
+            });
+      });
+}
+
+void MatchScene::pollSkipToEnd()
+{
+  if (skip_done.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+  {
+    return;
+  }
+
+  skip_done.get();
+  engine = std::make_unique<MatchEngine>(std::move(skip_job->engine));
+  skip_job.reset();
+  onMatchFinished();
+}
+
+void MatchScene::onMatchFinished()
+{
+  match_finished = true;
+  engine->setRecorder(nullptr);
+
+  GameController& controller = guiView->getController();
+  controller.setMatchResult(controller.getCurrentDate(), home_team_id,
+                            away_team_id, engine->getHomeScore(),
+                            engine->getAwayScore());
+  if (engine->getHeatmaps())
+  {
+    controller.addMatchHeatmaps(engine->getStats(), *heatmaps);
+    engine->setHeatmaps(nullptr);
+  }
+
+  std::string path = controller.getReplayPath(controller.getCurrentDate(),
+                                              home_team_id, away_team_id);
+  if (recorder.save(path))
+  {
+    replay_path = std::move(path);
+  }
+}
+
+void MatchScene::leaveMatch()
+{
+  guiView->popScene();  // Pop MatchScene
+  // Also advance day now that match is watched
+  guiView->getController().advanceDay();
+}
+
+void MatchScene::renderReplayControls()
+{
+  if (ImGui::Button(replay_playing ? "Pause" : "Play", ImVec2(100, 30)))
+  {
+    replay_playing = !replay_playing;
+  }
+  ImGui::SameLine();
+  ImGui::SetNextItemWidth(150.0f);
+  ImGui::SliderFloat("Speed", &match_speed, 0.5f, 5.0f, "%.1fx");
+  ImGui::SameLine();
+
+  // Seeking decodes from the nearest keyframe, so scrubbing stays cheap
+  int frame = static_cast<int>(replay_position);
+  ImGui::SetNextItemWidth(300.0f);
+  if (ImGui::SliderInt("Replay", &frame, 0,
+                       static_cast<int>(replay->getFrameCount()) - 1))
+  {
+    replay_position = static_cast<float>(frame);
+  }
+  ImGui::SameLine();
+  if (ImGui::Button("Close Replay", ImVec2(120, 30)))
+  {
+    replay.reset();
+    replay_playing = false;
+  }
+}
+
+void MatchScene::renderHeatmapControls()
+{
+  ImGui::Checkbox("Heatmap", &show_heatmap);
+  if (!show_heatmap) return;
+
+  const MatchStats& stats = engine->getStats();
+  if (heatmap_player == 0 && stats.playerCount > 0)
+  {
+    heatmap_player = stats.players[0].player;
+  }
+
+  ImGui::SameLine();
+  ImGui::SetNextItemWidth(200.0f);
+  if (ImGui::BeginCombo("##HeatmapPlayer", playerName(heatmap_player).c_str()))
+  {
+    for (size_t line = 0; line < stats.playerCount; ++line)
+    {
+      const PlayerID id = stats.players[line].player;
+      std::string label = std::format("{}##{}", playerName(id), line);
+      if (ImGui::Selectable(label.c_str(), id == heatmap_player))
+      {
+        heatmap_player = id;
+      }
+    }
+    ImGui::EndCombo();
+  }
+  ImGui::SameLine();
+  if (ImGui::RadioButton("Match", !show_season_heatmap))
+  {
+    show_season_heatmap = false;
+  }
+  ImGui::SameLine();
+  if (ImGui::RadioButton("Season", show_season_heatmap))
+  {
+    show_season_heatmap = true;
+  }
+}
+
+std::array<float, PlayerHeatmap::CELLS> MatchScene::heatmapIntensity() const
+{
+  std::array<float, PlayerHeatmap::CELLS> intensity{};
+  if (show_season_heatmap)
+  {
+    const SeasonHeatmap* season =
+        guiView->getController().getSeasonHeatmap(heatmap_player);
+    if (!season || season->peak() == 0) return intensity;
+    const auto peak = static_cast<float>(season->peak());
+    for (size_t cell = 0; cell < intensity.size(); ++cell)
+    {
+      intensity[cell] = static_cast<float>(season->cells[cell]) / peak;
+    }
+    return intensity;
+  }
+
+  const MatchStats& stats = engine->getStats();
+  const MatchStatLine* line = stats.forPlayer(heatmap_player);
+  if (!line || !heatmaps) return intensity;
+  const PlayerHeatmap& grid =
+      heatmaps->lines[static_cast<size_t>(line - stats.players.data())];
+  if (grid.peak() == 0) return intensity;
+  const auto peak = static_cast<float>(grid.peak());
+  for (size_t cell = 0; cell < intensity.size(); ++cell)
+  {
+    intensity[cell] = static_cast<float>(grid.cells[cell]) / peak;
+  }
+  return intensity;
+}
+
+std::string MatchScene::playerName(PlayerID id) const
+{
+  if (auto player = guiView->getController().getGameData()->getPlayer(id))
+  {
+    return player->get().getName();
+  }
+  return "Unknown";
+}
+
+std::string MatchScene::describeEvent(const MatchEvent& event) const
+{
+  switch (event.type)
+  {
+    case MatchEventType::KICKOFF:
+      return "Match started.";
+    case MatchEventType::SUBSTITUTION:
+      return std::format("Substitution: {} comes on.", playerName(event.actor));
+    case MatchEventType::SHOT:
+      return std::format("{} shoots!", playerName(event.actor));
+    case MatchEventType::PASS:
+      return std::format("{} passes to {}", playerName(event.actor),
+                         playerName(event.target));
+    case MatchEventType::CONTROL:
+      return std::format("{} controls the ball.", playerName(event.actor));
+    case MatchEventType::TACKLE:
+      return std::format("{} tackles the ball from {}!",
+                         playerName(event.actor), playerName(event.target));
+    case MatchEventType::GOAL:
+      return std::format("GOAL for {}!",
+                         event.isHomeTeam ? home_name : away_name);
+  }
+  return "";
+}
+
 void MatchScene::renderSubstitutionsModal()
 {
   ImGui::OpenPopup("Substitutions");
@@ -312,15 +687,15 @@ void MatchScene::renderSubstitutionsModal()
     ImGui::Columns(1);
     ImGui::Separator();
 
+    const Player* bench_ptr = nullptr;
+    for (auto p : lineup.getReserves())
+    {
+      if (p && p->getId() == selected_bench_player) bench_ptr = p;
+    }
+
     if (ImGui::Button("Swap Selected", ImVec2(120, 30)) &&
         selected_pitch_player != 0 && selected_bench_player != 0)
     {
-      const Player* bench_ptr = nullptr;
-      for (auto p : lineup.getReserves())
-      {
-        if (p && p->getId() == selected_bench_player) bench_ptr = p;
-      }
-
       if (bench_ptr &&
           lineup.swapPlayers(selected_bench_player, selected_pitch_player))
       {
@@ -330,11 +705,93 @@ void MatchScene::renderSubstitutionsModal()
       }
     }
     ImGui::SameLine();
+    if (ImGui::Button("What If?", ImVec2(120, 30)) && bench_ptr &&
+        selected_pitch_player != 0 && !what_if.valid())
+    {
+      startWhatIf(bench_ptr);
+    }
+    ImGui::SameLine();
     if (ImGui::Button("Close", ImVec2(120, 30)))
     {
       show_substitutions = false;
     }
 
+    renderWhatIf();
+
     ImGui::EndPopup();
   }
 }
+
+void MatchScene::startWhatIf(const Player* bench_player)
+{
+  what_if_pitch_player = selected_pitch_player;
+  what_if_bench_player = selected_bench_player;
+  what_if_result.reset();
+
+  // Both options replay the same seeds, so only the swap differs between them
+  std::vector<MatchEngine> forks;
+  forks.reserve(2 * WHAT_IF_FORKS);
+  for (int option = 0; option < 2; ++option)
+  {
+    for (int i = 0; i < WHAT_IF_FORKS; ++i)
+    {
+      forks.push_back(engine->fork(static_cast<uint64_t>(i)));
+      if (option == 1)
+      {
+        forks.back().substitutePlayer(what_if_pitch_player, bench_player);
+      }
+    }
+  }
+
+  auto managed = guiView->getController().getManagedTeam();
+  const bool managed_home =
+      !managed.has_value() || managed->get().getId() == home_team_id;
+  what_if = ThreadPool::shared().submit(
+      [forks = std::move(forks), managed_home]() mutable
+      {
+        ThreadPool::shared().parallelFor(
+            forks.size(), [&forks](size_t i) { forks[i].simulateRemaining(); });
+
+        WhatIfResult result;
+        const float share = 1.0f / static_cast<float>(WHAT_IF_FORKS);
+        for (size_t i = 0; i < forks.size(); ++i)
+        {
+          const size_t option = i / WHAT_IF_FORKS;
+          int margin = forks[i].getHomeScore() - forks[i].getAwayScore();
+          if (!managed_home) margin = -margin;
+          if (margin > 0) result.win[option] += share;
+          if (margin == 0) result.draw[option] += share;
+          if (margin < 0) result.loss[option] += share;
+        }
+        return result;
+      });
+}
+
+void MatchScene::renderWhatIf()
+{
+  if (what_if.valid() &&
+      what_if.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+  {
+    what_if_result = what_if.get();
+  }
+
+  if (what_if.valid())
+  {
+    ImGui::TextDisabled("Simulating the rest of the match...");
+    return;
+  }
+  if (!what_if_result || what_if_pitch_player != selected_pitch_player ||
+      what_if_bench_player != selected_bench_player)
+  {
+    return;
+  }
+
+  const char* labels[] = {"Keep lineup", "Make the swap"};
+  for (size_t option = 0; option < 2; ++option)
+  {
+    ImGui::Text("%s: Win %.0f%%  Draw %.0f%%  Loss %.0f%%", labels[option],
+                what_if_result->win[option] * 100.0f,
+                what_if_result->draw[option] * 100.0f,
+                what_if_result->loss[option] * 100.0f);
+  }
+}
@@ -8,14 +8,26 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+
 #include "gui/gui_scene.h"
 #include "model/match_engine.h"
+#include "model/match_heatmap.h"
+#include "model/match_replay.h"
 
 class MatchScene : public GUIScene
 {
  public:
   MatchScene(class GUIView* guiView_ptr, uint16_t home_id, uint16_t away_id);
 
+  /** @brief Stops and waits for a skip to end still running. */
+  ~MatchScene() override;
+
   void onEnter() override;
   void update(float deltaTime) override;
   void render() override;
@@ -32,12 +44,79 @@ class MatchScene : public GUIScene
 
   bool match_finished = false;
 
+  // Every tick of the match is recorded and saved at the final whistle
+  MatchReplayRecorder recorder;
+  std::string replay_path;
+  std::optional<MatchReplay> replay;
+  float replay_position = 0.0f;  // In frames
+  bool replay_playing = false;
+
+  // Player positions, tracked unless switched off, added to the season
+  // heatmaps at the final whistle and shown over the pitch afterwards
+  MatchHeatmaps* heatmaps = nullptr;
+  bool track_heatmaps = true;
+  bool show_heatmap = false;
+  bool show_season_heatmap = false;
+  PlayerID heatmap_player = 0;
+
   float match_speed = 1.0f;
   bool is_paused = false;
 
+  // Overlay of the engine's phase timings, offered in MATCH_PROFILING builds
+  bool show_profile = false;
+
+  // Remaining minutes played headlessly on a worker from a copy of the
+  // engine, so the live one can keep being displayed meanwhile
+  struct SkipJob
+  {
+    explicit SkipJob(const MatchEngine& live) : engine(live) {}
+
+    MatchEngine engine;
+    std::atomic<float> minute{0.0f};
+    std::atomic<bool> cancelled{false};
+  };
+
+  std::shared_ptr<SkipJob> skip_job;
+  std::future<void> skip_done;
+
+  // Outcome of the rest of the match for the managed team, estimated from
+  // forks of the live engine. Index 0 keeps the lineup, 1 makes the swap.
+  struct WhatIfResult
+  {
+    std::array<float, 2> win{};
+    std::array<float, 2> draw{};
+    std::array<float, 2> loss{};
+  };
+
+  /** @brief Continuations played out per option, with the same seeds. */
+  static constexpr int WHAT_IF_FORKS = 64;
+
+  std::future<WhatIfResult> what_if;
+  std::optional<WhatIfResult> what_if_result;
+  uint32_t what_if_pitch_player = 0;  // Swap the result refers to
+  uint32_t what_if_bench_player = 0;
+
   bool show_substitutions = false;
   uint32_t selected_pitch_player = 0;
   uint32_t selected_bench_player = 0;
 
+  /** @brief Number of most recent events shown in the log. */
+  static constexpr size_t VISIBLE_EVENTS = 10;
+
+  void startSkipToEnd();
+  void pollSkipToEnd();
+  void onMatchFinished();
+  void leaveMatch();
+  void renderReplayControls();
+  void renderHeatmapControls();
+  void renderProfileOverlay();
+
+  /** @brief Cells of the selected heatmap scaled to [0, 1], or all zero. */
+  std::array<float, PlayerHeatmap::CELLS> heatmapIntensity() const;
+
+  void startWhatIf(const Player* bench_player);
+  void renderWhatIf();
   void renderSubstitutionsModal();
+  std::string describeEvent(const MatchEvent& event) const;
+  std::string playerName(PlayerID id) const;
 };
@@ -13,6 +13,7 @@
 #include "global/language_manager.h"
 #include "gui/gui_constants.h"
 #include "gui/gui_view.h"
+#include "model/match_predictor.h"
 
 namespace
 {
@@ -22,7 +23,11 @@ constexpr float WINDOW_HEIGHT = 400.0f;
 
 StrategyScene::StrategyScene(GUIView* parent) : GUIScene(parent) {}
 
-void StrategyScene::onEnter() { loadStrategy(); }
+void StrategyScene::onEnter()
+{
+  loadStrategy();
+  predicted_sliders = current_sliders;
+}
 
 void StrategyScene::update(float deltaTime) { (void)deltaTime; }
 
@@ -48,6 +53,29 @@ void StrategyScene::render()
   ImGui::SliderFloat(LOC("STRATEGY_COMPACTNESS"), &current_sliders.compactness,
                      0.0f, 1.0f);
 
+  // Re-run the next fixture prediction with the sliders being edited
+  if (current_sliders != predicted_sliders)
+  {
+    guiView->getController().predictNextFixture(current_sliders);
+    predicted_sliders = current_sliders;
+  }
+
+  MatchPrediction prediction =
+      guiView->getController().getNextFixturePrediction();
+  if (prediction.completedRuns > 0)
+  {
+    ImGui::Spacing();
+    ImGui::Text(LOC("PREDICTION_OUTCOME"), prediction.homeWin * 100.0f,
+                prediction.draw * 100.0f, prediction.awayWin * 100.0f);
+    ImGui::Text(LOC("PREDICTION_GOALS"), prediction.expectedHomeGoals,
+                prediction.expectedAwayGoals);
+    if (!prediction.isComplete())
+    {
+      ImGui::TextDisabled(LOC("PREDICTION_PROGRESS"), prediction.completedRuns,
+                          prediction.requestedRuns);
+    }
+  }
+
   ImGui::Spacing();
   ImGui::Separator();
   ImGui::Spacing();
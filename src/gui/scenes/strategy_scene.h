@@ -54,4 +54,5 @@ class StrategyScene : public GUIScene
   void loadStrategy();
 
   StrategySliders current_sliders;
+  StrategySliders predicted_sliders;  // Sliders of the running prediction
 };
@@ -8,26 +8,48 @@
 
 #include "model/game.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include "database/database_connection.h"
 #include "database/gamedata.h"
 #include "database/repositories/fixture_repository.h"
 #include "database/repositories/game_state_repository.h"
+#include "database/repositories/heatmap_repository.h"
 #include "database/repositories/league_repository.h"
 #include "global/global.h"
 #include "global/logger.h"
 #include "global/paths.h"
+#include "global/thread_pool.h"
 #include "model/league.h"
 #include "model/role_utils.h"
 #include "model/team.h"
 
+namespace
+{
+// Derives a stable seed from the fixture itself so that a replayed matchday
+// produces the same results, whatever thread the fixture runs on.
+uint64_t fixtureSeed(const Match& match)
+{
+  const GameDateValue& date = match.getDate();
+  return (uint64_t{date.year} << 48) | (uint64_t{date.month} << 40) |
+         (uint64_t{date.day} << 32) |
+         (uint64_t{match.getHomeTeamId()} << 16) | match.getAwayTeamId();
+}
+}  // namespace
+
 Game::Game(std::shared_ptr<GameData> gd,
-           std::shared_ptr<DatabaseConnection> conn)
+           std::shared_ptr<DatabaseConnection> conn,
+           std::optional<uint64_t> seed)
     : db_conn(std::move(conn)), gamedata(std::move(gd)), currentDate(START_DATE)
 {
-  (*gamedata).loadFromDB(db_conn);
+  if (!GameStateRepository(db_conn).loadRandomState(random))
+  {
+    random.reseed(seed ? *seed : RandomService::freshSeed());
+  }
+  (*gamedata).loadFromDB(db_conn, random.stream(RandomService::GENERATION));
   loadGame();
+  scheduler.scheduleSeason(calendar, currentDate);
 }
 
 void Game::loadGame()
@@ -39,6 +61,7 @@ void Game::loadGame()
   {
     currentDate = GameDateValue::fromString(game_date_str);
     fixtureRepo.loadCalendar(calendar);
+    season_heatmaps = HeatmapRepository(db_conn).loadSeason(current_season);
     Logger::debug("Game loaded. Date: " + game_date_str +
                   ", Season: " + std::to_string(current_season));
   }
@@ -49,6 +72,7 @@ void Game::loadGame()
     managed_team_id = FREE_AGENTS_TEAM_ID;  // Or some other default
     currentDate = START_DATE;
     calendar.generate((*gamedata), currentDate);
+    calendar_dirty = true;
     Logger::debug("First run, initializing game state.");
     saveGame();
   }
@@ -62,16 +86,22 @@ void Game::loadGame()
 
 void Game::saveGame()
 {
+  const auto start = GameTimings::Clock::now();
   db_conn->beginTransaction();
   try
   {
     GameStateRepository gameStateRepo(db_conn);
     FixtureRepository fixtureRepo(db_conn);
     LeagueRepository leagueRepo(db_conn);
+    HeatmapRepository heatmapRepo(db_conn);
 
     gameStateRepo.updateGameState(current_season, managed_team_id,
                                   currentDate.toString());
-    fixtureRepo.saveCalendar(calendar);
+    gameStateRepo.saveRandomState(random);
+    // Results are written as matchdays are played, the fixtures themselves
+    // only once per season
+    if (calendar_dirty) fixtureRepo.saveCalendar(calendar);
+    heatmapRepo.saveSeason(current_season, season_heatmaps);
 
     for (const auto& [id, league] : (*gamedata).getLeagues())
     {
@@ -85,60 +115,159 @@ void Game::saveGame()
     Logger::error("Failed to save game: " + std::string(e.what()));
     throw;
   }
+  calendar_dirty = false;
+  timings.add(GameTimings::PERSISTENCE, start);
 
   Logger::debug("Game saved.");
 }
 
-void Game::advanceDay()
+void Game::saveResults(std::span<const Match> matches)
 {
-  currentDate.nextDay();
-  Logger::debug("Date changed to: " + currentDate.toString());
+  // An unsaved calendar has no rows yet; saveGame() writes it with results
+  if (calendar_dirty) return;
 
-  if (currentDate.month == 7 && currentDate.day == 1)
+  const auto start = GameTimings::Clock::now();
+  db_conn->beginTransaction();
+  try
   {
-    handleSeasonTransition();
-    return;
+    FixtureRepository(db_conn).saveResults(matches);
+    db_conn->commitTransaction();
   }
-
-  const auto& matches_today = calendar.getMatchesForDate(currentDate);
-  if (!matches_today.empty())
+  catch (const std::exception& e)
   {
-    auto matches_to_simulate = matches_today;
-    simulateMatches(matches_to_simulate);
+    db_conn->rollbackTransaction();
+    Logger::error("Failed to save results: " + std::string(e.what()));
+    throw;
   }
+  timings.add(GameTimings::PERSISTENCE, start);
 }
 
-void Game::simulateMatches(std::vector<Match>& matches)
+void Game::advanceDay() { advanceToNextEvent(currentDate + 1); }
+
+std::span<const GameEvent> Game::advanceToNextEvent(const GameDateValue& limit)
 {
-  for (auto& match : matches)
+  // A deferred fixture the user did not play is simulated before moving on
+  const std::vector<Match>& today = calendar.getMatchesForDate(currentDate);
+  if (!std::ranges::all_of(today, &Match::isPlayed))
   {
-    match.simulate((*gamedata));
+    const auto start = GameTimings::Clock::now();
+    std::vector<Match>& matches =
+        calendar.getMatchesForDateMutable(currentDate);
+    simulateMatches(matches, false);
+    timings.add(GameTimings::MATCHES, start);
+    saveResults(matches);
+  }
 
-    auto home_team_opt = (*gamedata).getTeam(match.getHomeTeamId());
-    auto away_team_opt = (*gamedata).getTeam(match.getAwayTeamId());
+  // Days without events need no processing, only the date moves
+  const std::optional<GameDateValue> next = scheduler.nextDate();
+  currentDate = next && *next < limit ? *next : limit;
+  Logger::debug("Date changed to: " + currentDate.toString());
 
-    if (home_team_opt && away_team_opt)
+  scheduler.popDue(currentDate, day_events);
+  for (const GameEvent& event : day_events)
+  {
+    const auto start = GameTimings::Clock::now();
+    switch (event.type)
     {
-      Team& home_team = home_team_opt->get();
-      Team& away_team = away_team_opt->get();
-
-      updateStandings(match);
+      case GameEventType::SEASON_ROLLOVER:
+        handleSeasonTransition();
+        timings.add(GameTimings::SEASON_ROLLOVER, start);
+        break;
+      case GameEventType::FIXTURES:
+      {
+        // The stored fixtures are played, so results stay in the calendar
+        std::vector<Match>& matches =
+            calendar.getMatchesForDateMutable(currentDate);
+        simulateMatches(matches, defer_managed_fixtures);
+        timings.add(GameTimings::MATCHES, start);
+        saveResults(matches);
+        break;
+      }
+      case GameEventType::TRAINING:
+        trainTeamsThatPlayed(calendar.getMatchesForDate(currentDate));
+        timings.add(GameTimings::TRAINING, start);
+        break;
+      case GameEventType::TRANSFER_WINDOW_OPEN:
+      case GameEventType::TRANSFER_WINDOW_CLOSE:
+      case GameEventType::MARKET_TICK:
+        break;
+    }
+  }
+  return day_events;
+}
 
-      trainPlayers(home_team.getPlayerIDs());
-      trainPlayers(away_team.getPlayerIDs());
+void Game::simulateMatches(std::vector<Match>& matches, bool defer_managed)
+{
+  std::vector<size_t> pending;
+  pending.reserve(matches.size());
+  for (size_t i = 0; i < matches.size(); ++i)
+  {
+    const Match& match = matches[i];
+    if (match.isPlayed() || (defer_managed && isManagedFixture(match)))
+    {
+      continue;
+    }
+    pending.push_back(i);
+  }
 
-      if (home_team.getId() == managed_team_id ||
-          away_team.getId() == managed_team_id)
+  // Simulation phase: every fixture only reads GameData and writes its own
+  // Match, so fixtures run in parallel, each with its own seed
+  ThreadPool::shared().parallelFor(
+      pending.size(),
+      [this, &matches, &pending](size_t i)
       {
-        std::cout << home_team.getName() << " "
-                  << static_cast<int>(match.getHomeScore()) << " - "
-                  << static_cast<int>(match.getAwayScore()) << " "
-                  << away_team.getName() << "\n";
-      }
+        Match& match = matches[pending[i]];
+        const MatchSimulator& simulator =
+            MatchSimulator::forTier(getSimulationTier(match));
+        match.simulate((*gamedata), simulator,
+                       fixtureSeed(match) ^ random.getSeed());
+      });
+
+  // Commit phase: apply results in fixture order so standings and training
+  // do not depend on which thread finished first
+  for (size_t i : pending)
+  {
+    const Match& match = matches[i];
+    if (!(*gamedata).getTeam(match.getHomeTeamId()) ||
+        !(*gamedata).getTeam(match.getAwayTeamId()))
+    {
+      continue;
     }
+    updateStandings(match);
+    if (isManagedFixture(match)) printManagedResult(match);
   }
 }
 
+bool Game::recordMatchResult(Match& match, uint8_t home_score,
+                             uint8_t away_score)
+{
+  if (match.isPlayed()) return false;
+
+  match.setPlayedResult(home_score, away_score);
+  updateStandings(match);
+  printManagedResult(match);
+  saveResults(std::span(&match, 1));
+  return true;
+}
+
+bool Game::isManagedFixture(const Match& match) const
+{
+  return match.getHomeTeamId() == managed_team_id ||
+         match.getAwayTeamId() == managed_team_id;
+}
+
+void Game::printManagedResult(const Match& match) const
+{
+  auto home_team_opt = (*gamedata).getTeam(match.getHomeTeamId());
+  auto away_team_opt = (*gamedata).getTeam(match.getAwayTeamId());
+  if (!home_team_opt || !away_team_opt) return;
+
+  std::cout << home_team_opt->get().getName() << " "
+            << static_cast<int>(match.getHomeScore()) << " - "
+            << static_cast<int>(match.getAwayScore()) << " "
+            << away_team_opt->get().getName() << "\n";
+}
+
 void Game::updateStandings(const Match& match)
 {
   if (match.getMatchType() != MatchType::LEAGUE)
@@ -178,6 +307,9 @@ void Game::endSeason()
             << " has concluded. ---"
             << "\n";
   (*gamedata).ageAllPlayers();
+  // The finished season's heatmaps are kept in the database only
+  HeatmapRepository(db_conn).saveSeason(current_season, season_heatmaps);
+  season_heatmaps.clear();
   current_season++;
 }
 
@@ -194,6 +326,8 @@ void Game::startNewSeason()
     league.resetPoints();
   }
   calendar.generate((*gamedata), currentDate);
+  calendar_dirty = true;
+  scheduler.scheduleSeason(calendar, currentDate);
 }
 
 const GameDateValue& Game::getCurrentDate() const { return currentDate; }
@@ -208,8 +342,66 @@ uint16_t Game::getManagedTeamId() const { return managed_team_id; }
 
 void Game::setManagedTeamId(uint16_t id) { managed_team_id = id; }
 
+void Game::addMatchHeatmaps(const MatchStats& stats,
+                            const MatchHeatmaps& heatmaps)
+{
+  for (size_t line = 0; line < stats.playerCount; ++line)
+  {
+    season_heatmaps[stats.players[line].player].add(heatmaps.lines[line]);
+  }
+}
+
+const SeasonHeatmap* Game::getSeasonHeatmap(PlayerID player_id) const
+{
+  auto it = season_heatmaps.find(player_id);
+  return it != season_heatmaps.end() ? &it->second : nullptr;
+}
+
+SimulationTier Game::getSimulationTier(const Match& match) const
+{
+  if (tier_override.has_value()) return *tier_override;
+  if (!tiered_simulation) return SimulationTier::STATISTICAL;
+
+  if (match.getHomeTeamId() == managed_team_id ||
+      match.getAwayTeamId() == managed_team_id)
+  {
+    return SimulationTier::FULL_PHYSICS;
+  }
+
+  auto managed_team_opt = (*gamedata).getTeam(managed_team_id);
+  auto home_team_opt = (*gamedata).getTeam(match.getHomeTeamId());
+  if (managed_team_opt && home_team_opt &&
+      managed_team_opt->get().getLeagueId() ==
+          home_team_opt->get().getLeagueId())
+  {
+    return SimulationTier::REDUCED_PHYSICS;
+  }
+  return SimulationTier::STATISTICAL;
+}
+
+void Game::setSimulationTierOverride(std::optional<SimulationTier> tier)
+{
+  tier_override = tier;
+}
+
+void Game::setTieredSimulation(bool enabled) { tiered_simulation = enabled; }
+
+void Game::setManagedFixturesDeferred(bool deferred)
+{
+  defer_managed_fixtures = deferred;
+}
+
+void Game::setSeed(uint64_t seed) { random.reseed(seed); }
+
+RandomService& Game::getRandom() { return random; }
+
+const GameTimings& Game::getTimings() const { return timings; }
+
+GameTimings& Game::getTimings() { return timings; }
+
 void Game::trainPlayers(const std::vector<uint32_t>& player_ids)
 {
+  RandomStream& rng = random.stream(RandomService::TRAINING);
   auto stats_config = (*gamedata).getStatsConfig();
   for (auto& player_id : player_ids)
   {
@@ -218,6 +410,19 @@ void Game::trainPlayers(const std::vector<uint32_t>& player_ids)
         stats_config.role_focus
             .at(RoleUtils::getBroadCategory(player.getRole()))
             .stats;
-    player.train(focus_stats);
+    player.train(focus_stats, rng);
+  }
+}
+
+void Game::trainTeamsThatPlayed(const std::vector<Match>& matches)
+{
+  for (const auto& match : matches)
+  {
+    auto home_team_opt = (*gamedata).getTeam(match.getHomeTeamId());
+    auto away_team_opt = (*gamedata).getTeam(match.getAwayTeamId());
+    if (!home_team_opt || !away_team_opt) continue;
+
+    trainPlayers(home_team_opt->get().getPlayerIDs());
+    trainPlayers(away_team_opt->get().getPlayerIDs());
   }
 }
@@ -10,12 +10,20 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
 #include <vector>
 
 #include "database/database_connection.h"
+#include "global/random_service.h"
 #include "model/calendar.h"
+#include "model/game_scheduler.h"
+#include "model/game_timings.h"
 #include "model/gamedate.h"
 #include "model/match.h"
+#include "model/match_heatmap.h"
+#include "model/match_simulator.h"
 
 /**
  * @class Game
@@ -32,9 +40,12 @@ class Game
    * @brief Constructs a new Game object.
    * @param gd Shared pointer to the GameData instance.
    * @param conn Shared pointer to the DatabaseConnection.
+   * @param seed Seed of a new game, a fresh one if not given. A saved game
+   * continues from its saved random state instead.
    */
   explicit Game(std::shared_ptr<class GameData> gd,
-                std::shared_ptr<DatabaseConnection> conn);
+                std::shared_ptr<DatabaseConnection> conn,
+                std::optional<uint64_t> seed = std::nullopt);
 
   /**
    * @brief Advances the game time by one day, simulating any matches or events
@@ -42,6 +53,16 @@ class Game
    */
   void advanceDay();
 
+  /**
+   * @brief Moves the date straight to the next day with a scheduled event, or
+   * to @p limit if that comes first, and processes that day's events.
+   *
+   * Fixtures, training and the season rollover are handled here; the
+   * transfer window events are left to the caller.
+   * @return The events of the new date, valid until the next call.
+   */
+  std::span<const GameEvent> advanceToNextEvent(const GameDateValue& limit);
+
   /**
    * @brief Retrieves the current in-game date.
    * @return A constant reference to the current GameDateValue.
@@ -73,12 +94,89 @@ class Game
    */
   void setManagedTeamId(uint16_t id);
 
+  /**
+   * @brief Tier a fixture is simulated at when the day is advanced: the
+   * statistical model, unless tiered simulation is enabled, see
+   * setTieredSimulation() for what that does to the standings.
+   * @param match The fixture to simulate.
+   */
+  SimulationTier getSimulationTier(const Match& match) const;
+
+  /**
+   * @brief Picks a tier per fixture instead of the statistical model for
+   * all: full physics when the managed team plays, reduced physics for the
+   * rest of its league and the statistical model for every other league.
+   * Off by default.
+   *
+   * The tiers roughly agree on who wins, so points stay comparable, but not
+   * on how many goals: the engine scores about five a side, the statistical
+   * model about 1.5. Scorelines of the managed team's league are not
+   * comparable with the other leagues' while this is on.
+   */
+  void setTieredSimulation(bool enabled);
+
+  /**
+   * @brief Forces every fixture onto one tier, e.g. the statistical model for
+   * fast multi-season runs.
+   * @param tier The tier to use, or std::nullopt to pick one per fixture.
+   */
+  void setSimulationTierOverride(std::optional<SimulationTier> tier);
+
+  /**
+   * @brief Leaves the managed team's fixtures unplayed on their matchday, for
+   * the user to play them and recordMatchResult() the score. One still
+   * unplayed when the date moves on is simulated then. Off by default.
+   */
+  void setManagedFixturesDeferred(bool deferred);
+
+  /**
+   * @brief Plays a deferred fixture with the given score, updating the
+   * standings and its saved result.
+   * @param match The fixture, in the calendar.
+   * @return False if the fixture had already been played.
+   */
+  bool recordMatchResult(Match& match, uint8_t home_score, uint8_t away_score);
+
+  /**
+   * @brief Restarts the game's randomness from @p seed: every stream of
+   * getRandom() and the seed mixed into every fixture, so that runs with the
+   * same seed play the same seasons and runs with another seed do not.
+   */
+  void setSeed(uint64_t seed);
+
+  /** @brief The game's random streams, saved and loaded with the game. */
+  RandomService& getRandom();
+
+  /** @brief Time spent in each phase of advancing, see GameTimings. */
+  const GameTimings& getTimings() const;
+  GameTimings& getTimings();
+
+  /**
+   * @brief Adds the heatmaps of a tracked match to the season heatmaps of
+   * the players who took part.
+   * @param stats Statistics of the match, mapping its heatmaps to players.
+   * @param heatmaps Heatmaps the engine filled during the match.
+   */
+  void addMatchHeatmaps(const MatchStats& stats, const MatchHeatmaps& heatmaps);
+
+  /**
+   * @brief Retrieves a player's heatmap over the current season.
+   * @return Null if none of the player's matches were tracked.
+   */
+  const SeasonHeatmap* getSeasonHeatmap(PlayerID player_id) const;
+
   /**
    * @brief Saves the current game state, including calendar and game variables,
    * to the database.
    */
   void saveGame();
 
+  /**
+   * @brief Writes the results of @p matches, which live in the calendar, to
+   * their saved fixtures.
+   */
+  void saveResults(std::span<const Match> matches);
+
  private:
   void loadGame();
   void endSeason();
@@ -87,15 +185,28 @@ class Game
 
   // Player training
   void trainPlayers(const std::vector<uint32_t>& player_ids);
+  void trainTeamsThatPlayed(const std::vector<Match>& matches);
 
-  // Matchday simulation helper
-  void simulateMatches(std::vector<Match>& matches);
+  // Matchday simulation helper: parallel simulation, then serial commit of
+  // the fixtures still unplayed, except deferred ones if defer_managed
+  void simulateMatches(std::vector<Match>& matches, bool defer_managed);
+  bool isManagedFixture(const Match& match) const;
+  void printManagedResult(const Match& match) const;
   void updateStandings(const Match& match);
 
   std::shared_ptr<DatabaseConnection> db_conn;
   std::shared_ptr<class GameData> gamedata;
   Calendar calendar;
+  bool calendar_dirty = false;  // Generated but not saved yet
+  GameScheduler scheduler;
+  std::vector<GameEvent> day_events;  // Events of currentDate
   GameDateValue currentDate;
   uint8_t current_season = 1;
   uint16_t managed_team_id;
+  std::optional<SimulationTier> tier_override;
+  bool tiered_simulation = false;
+  bool defer_managed_fixtures = false;
+  RandomService random;
+  GameTimings timings;
+  std::unordered_map<PlayerID, SeasonHeatmap> season_heatmaps;
 };
@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "model/game_scheduler.h"
+
+#include "model/calendar.h"
+
+void GameScheduler::schedule(const GameEvent& event) { queue.push(event); }
+
+void GameScheduler::scheduleSeason(const Calendar& calendar,
+                                   const GameDateValue& from)
+{
+  const GameDateValue rollover = nextRollover(from);
+
+  for (const auto& [date, matches] : calendar.getFullCalendar())
+  {
+    if (!(from < date) || rollover < date || matches.empty()) continue;
+    schedule({date, GameEventType::FIXTURES});
+    schedule({date, GameEventType::TRAINING});
+  }
+
+  // Windows span whole months, so closed months are skipped in one step
+  bool was_open = from.isTransferWindowOpen();
+  GameDateValue date = from + 1;
+  while (!(rollover < date))
+  {
+    const bool open = date.isTransferWindowOpen();
+    if (open != was_open)
+    {
+      schedule({date, open ? GameEventType::TRANSFER_WINDOW_OPEN
+                           : GameEventType::TRANSFER_WINDOW_CLOSE});
+      was_open = open;
+    }
+    if (open)
+    {
+      schedule({date, GameEventType::MARKET_TICK});
+      date.nextDay();
+    }
+    else
+    {
+      date.day = 1;
+      date.nextMonth();
+    }
+  }
+
+  schedule({rollover, GameEventType::SEASON_ROLLOVER});
+}
+
+std::optional<GameDateValue> GameScheduler::nextDate() const
+{
+  if (queue.empty()) return std::nullopt;
+  return queue.top().date;
+}
+
+void GameScheduler::popDue(const GameDateValue& date,
+                           std::vector<GameEvent>& out)
+{
+  out.clear();
+  while (!queue.empty() && !(date < queue.top().date))
+  {
+    out.push_back(queue.top());
+    queue.pop();
+  }
+}
+
+void GameScheduler::clear() { queue = {}; }
+
+GameDateValue GameScheduler::nextRollover(const GameDateValue& date)
+{
+  const bool before_july = date.month < 7;
+  const auto year = static_cast<uint16_t>(date.year + (before_july ? 0 : 1));
+  return GameDateValue(year, 7, 1);
+}
@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <queue>
+#include <vector>
+
+#include "model/gamedate.h"
+
+class Calendar;
+
+/**
+ * @enum GameEventType
+ * @brief What happens on a scheduled day. Events of the same day are
+ * processed in this order.
+ */
+enum class GameEventType : uint8_t
+{
+  SEASON_ROLLOVER,       /*!< Season ends, players age, new calendar */
+  FIXTURES,              /*!< The day's matches are played */
+  TRAINING,              /*!< Teams that played train afterwards */
+  TRANSFER_WINDOW_OPEN,  /*!< First day of a transfer window */
+  TRANSFER_WINDOW_CLOSE, /*!< First day after a transfer window */
+  MARKET_TICK            /*!< AI teams list, bid and sign players */
+};
+
+/**
+ * @struct GameEvent
+ * @brief An event due on a date.
+ */
+struct GameEvent
+{
+  GameDateValue date;
+  GameEventType type;
+};
+
+/**
+ * @class GameScheduler
+ * @brief Queue of the upcoming game events, earliest first, so that time can
+ * jump straight to the next day with something to process.
+ */
+class GameScheduler
+{
+ public:
+  /** @brief Queues a single event. */
+  void schedule(const GameEvent& event);
+
+  /**
+   * @brief Queues every event after @p from up to and including the next
+   * season rollover: fixture days of @p calendar, transfer window bounds and
+   * a market tick for every day of a window.
+   */
+  void scheduleSeason(const Calendar& calendar, const GameDateValue& from);
+
+  /** @brief Date of the earliest queued event, if any. */
+  std::optional<GameDateValue> nextDate() const;
+
+  /**
+   * @brief Moves every event due on or before @p date into @p out, in
+   * processing order. @p out is cleared first.
+   */
+  void popDue(const GameDateValue& date, std::vector<GameEvent>& out);
+
+  void clear();
+  size_t size() const { return queue.size(); }
+
+  /** @brief The first season rollover after @p date, on July 1. */
+  static GameDateValue nextRollover(const GameDateValue& date);
+
+ private:
+  // Orders the heap so that top() is the earliest event
+  struct Later
+  {
+    bool operator()(const GameEvent& a, const GameEvent& b) const
+    {
+      if (a.date == b.date) return a.type > b.type;
+      return b.date < a.date;
+    }
+  };
+
+  std::priority_queue<GameEvent, std::vector<GameEvent>, Later> queue;
+};
@@ -0,0 +1,49 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @struct GameTimings
+ * @brief Wall time spent in each phase of advancing the game since it was
+ * loaded, e.g. for fm_sim to report where a long run goes.
+ *
+ * Phases are timed once per scheduled event, not per player or fixture, so
+ * the clock reads are negligible and the timings are always on.
+ */
+struct GameTimings
+{
+  using Clock = std::chrono::steady_clock;
+
+  enum Phase : uint8_t
+  {
+    MATCHES,         /*!< Simulation and results of the fixtures */
+    TRAINING,        /*!< Training after matchdays */
+    AI_TRANSFERS,    /*!< Listings, bids and signings of AI teams */
+    PERSISTENCE,     /*!< Saves and commits to the database */
+    SEASON_ROLLOVER, /*!< Aging, standings reset and the new calendar */
+    PHASE_COUNT
+  };
+
+  std::array<Clock::duration, PHASE_COUNT> elapsed{};
+
+  /** @brief Adds the time since @p start, taken from Clock::now(). */
+  void add(Phase phase, Clock::time_point start)
+  {
+    elapsed[phase] += Clock::now() - start;
+  }
+
+  double seconds(Phase phase) const
+  {
+    return std::chrono::duration<double>(elapsed[phase]).count();
+  }
+};
@@ -99,6 +99,21 @@ GameDateValue GameDateValue::operator-(size_t days) const
   return tmp;
 }
 
+int GameDateValue::daysUntil(const GameDateValue& other) const
+{
+  return dayNumber(other) - dayNumber(*this);
+}
+
+// Days since 1 March of year 0, counting years from March so that the leap
+// day falls at the end of one
+int GameDateValue::dayNumber(const GameDateValue& date)
+{
+  const int y = date.year - (date.month <= 2 ? 1 : 0);
+  const int m = date.month <= 2 ? date.month + 9 : date.month - 3;
+  const int day_of_year = (153 * m + 2) / 5 + date.day - 1;
+  return y * 365 + y / 4 - y / 100 + y / 400 + day_of_year;
+}
+
 bool GameDateValue::operator<(const GameDateValue& other) const
 {
   if (year != other.year) return year < other.year;
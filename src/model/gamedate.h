@@ -64,6 +64,12 @@ struct GameDateValue
    * @return The new date.
    */
   GameDateValue operator-(size_t days) const;
+  /**
+   * @brief Counts the days from this date to another.
+   * @param other The date to count to.
+   * @return Days between the dates, negative if @p other is earlier.
+   */
+  int daysUntil(const GameDateValue& other) const;
 
   // ----------------------
   // Comparisons
@@ -112,6 +118,7 @@ struct GameDateValue
 
  private:
   static bool isLeapYear(uint16_t y);
+  static int dayNumber(const GameDateValue& date);
   static uint8_t daysInMonth(uint8_t m, uint16_t y);
 };
 
@@ -33,6 +33,9 @@ class Lineup
    */
   Lineup();
 
+  /** @brief Same players, by pointer, in the same places and strategy. */
+  bool operator==(const Lineup&) const = default;
+
   // Goalkeeper
   /**
    * @brief Sets the goalkeeper.
@@ -51,6 +54,8 @@ class Lineup
   {
     const Player* player;
     Vector2F position;
+
+    bool operator==(const PositionedPlayer&) const = default;
   };
 
   /**
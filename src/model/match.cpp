@@ -8,13 +8,8 @@
 
 #include "match.h"
 
-#include <random>
-#include <string>
-
 #include "database/gamedata.h"
-#include "lineup.h"
-#include "model/role_utils.h"
-#include "player.h"
+#include "model/match_simulator.h"
 
 Match::Match(TeamID home_id, TeamID away_id, GameDateValue date, MatchType type)
     : home_team_id(home_id),
@@ -26,7 +21,8 @@ Match::Match(TeamID home_id, TeamID away_id, GameDateValue date, MatchType type)
 {
 }
 
-void Match::simulate(const GameData& game_data)
+void Match::simulate(const GameData& game_data,
+                     const MatchSimulator& simulator, uint64_t seed)
 {
   _played = true;
   auto home_team_opt = game_data.getTeam(home_team_id);
@@ -35,44 +31,12 @@ void Match::simulate(const GameData& game_data)
   {
     return;  // Or handle error appropriately
   }
-  const Team& home_team = home_team_opt->get();
-  const Team& away_team = away_team_opt->get();
-
-  auto getAvgOvr = [&](const Lineup& l)
-  {
-    float sum = 0.0f;
-    int count = 0;
-    if (auto gk = l.getGoalkeeper())
-    {
-      sum += gk->getOverall(game_data.getStatsConfig());
-      count++;
-    }
-    for (auto& p : l.getOutfieldPlayers())
-    {
-      if (p.player)
-      {
-        sum += p.player->getOverall(game_data.getStatsConfig());
-        count++;
-      }
-    }
-    return count > 0 ? sum / count : 50.0f;
-  };
-
-  float homeOvr = getAvgOvr(home_team.getLineup());
-  float awayOvr = getAvgOvr(away_team.getLineup());
-
-  std::mt19937 rng(std::random_device{}());
-
-  float homeExpected =
-      std::max(0.1f, (homeOvr / 100.0f) * 2.5f + (homeOvr - awayOvr) / 20.0f);
-  float awayExpected =
-      std::max(0.1f, (awayOvr / 100.0f) * 2.0f + (awayOvr - homeOvr) / 20.0f);
-
-  std::poisson_distribution<int> homeGoals(homeExpected);
-  std::poisson_distribution<int> awayGoals(awayExpected);
 
-  home_score = homeGoals(rng);
-  away_score = awayGoals(rng);
+  MatchScore score =
+      simulator.simulate(home_team_opt->get(), away_team_opt->get(),
+                         game_data.getStatsConfig(), seed);
+  home_score = static_cast<uint8_t>(score.home);
+  away_score = static_cast<uint8_t>(score.away);
 }
 
 void Match::setPlayedResult(uint8_t h, uint8_t a)
@@ -14,6 +14,7 @@
 #include "global/types.h"
 
 class GameData;
+class MatchSimulator;
 
 /**
  * @class Match
@@ -32,10 +33,13 @@ class Match
   Match(TeamID home_id, TeamID away_id, GameDateValue date, MatchType type);
 
   /**
-   * @brief Simulates the match using the provided game data.
+   * @brief Simulates the match at the fidelity of the given simulator.
    * @param game_data Reference to the GameData used for simulation.
+   * @param simulator Tier that resolves the match, see MatchSimulator.
+   * @param seed Seed for the simulator, the same seed gives the same score.
    */
-  void simulate(const GameData& game_data);
+  void simulate(const GameData& game_data, const MatchSimulator& simulator,
+                uint64_t seed);
 
   /**
    * @brief Gets the ID of the home team.
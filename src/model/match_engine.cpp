@@ -11,12 +11,17 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
-#include <random>
 
+#include "model/match_heatmap.h"
+#include "model/match_replay.h"
 #include "model/role_utils.h"
 
 namespace
 {
+constexpr float TACKLE_RANGE = 0.04f;
+constexpr float CONTEST_MARGIN = 0.001f;
+constexpr float LONG_SHOT_RANGE = 0.25f;
+
 float distance(Vector2F a, Vector2F b)
 {
   float dx = a.x - b.x;
@@ -32,20 +37,146 @@ Vector2F normalize(Vector2F v)
   }
   return {0.0f, 0.0f};
 }
+
+float statOrZero(const Player& player, const std::string& name)
+{
+  const auto& stats = player.getStats();
+  auto it = stats.find(name);
+  return it != stats.end() ? it->second / 100.0f : 0.0f;
+}
 }  // namespace
 
+MatchAttributes MatchAttributes::fromPlayer(const Player& player,
+                                            const StatsConfig& config)
+{
+  MatchAttributes attributes;
+  attributes.overall = static_cast<float>(player.getOverall(config) / 100.0);
+  attributes.pace = statOrZero(player, "Pace");
+  attributes.passing = statOrZero(player, "Passing");
+  attributes.shooting = statOrZero(player, "Shooting");
+  attributes.defending = statOrZero(player, "Defending");
+  attributes.goalkeeping = statOrZero(player, "Goalkeeping");
+  return attributes;
+}
+
+float MatchAttributes::maxSpeed() const
+{
+  return 0.05f + overall * 0.15f;
+}
+
+float MatchAttributes::acceleration() const
+{
+  return 0.1f + overall * 0.2f;
+}
+
+const MatchStatLine* MatchStats::forPlayer(PlayerID id) const
+{
+  for (size_t i = 0; i < playerCount; ++i)
+  {
+    if (players[i].player == id) return &players[i];
+  }
+  return nullptr;
+}
+
+float MatchStats::possessionShare(bool isHomeTeam) const
+{
+  const float total = home.possessionMinutes + away.possessionMinutes;
+  if (total <= 0.0f) return 0.5f;
+  return team(isHomeTeam).possessionMinutes / total;
+}
+
+float MatchStats::shotExpectedGoals(float distance)
+{
+  // Close shots beat the keeper almost every time, the rest about a quarter
+  return 0.25f + 0.72f / (1.0f + std::exp((distance - 0.09f) / 0.006f));
+}
+
+void MatchEventLog::push(const MatchEvent& event)
+{
+  if (count == CAPACITY)
+  {
+    std::copy(storage.begin() + CAPACITY / 2, storage.end(), storage.begin());
+    count = CAPACITY / 2;
+  }
+  storage[count++] = event;
+}
+
+void MatchEventLog::assign(std::span<const MatchEvent> events)
+{
+  if (events.size() > CAPACITY) events = events.last(CAPACITY);
+  std::ranges::copy(events, storage.begin());
+  count = events.size();
+}
+
 MatchEngine::MatchEngine(const Lineup& home_lineup, const Lineup& away_lineup,
                          const Strategy& home_strat, const Strategy& away_strat,
-                         const StatsConfig& config)
-    : statsConfig(config), homeStrategy(home_strat), awayStrategy(away_strat)
+                         const StatsConfig& config, uint64_t matchSeed)
+    : statsConfig(&config)
 {
+  players.reserve(MatchKinematics::CAPACITY);
+  reset(home_lineup, away_lineup, home_strat, away_strat, config, matchSeed);
+}
+
+void MatchEngine::reset(const Lineup& home_lineup, const Lineup& away_lineup,
+                        const Strategy& home_strat, const Strategy& away_strat,
+                        const StatsConfig& config, uint64_t matchSeed)
+{
+  // Every member a match changes, containers keep their capacity
+  players.clear();
+  kinematics.clear();
+  ball = {};
+  formation = {};
+  statsConfig = &config;
+  homeStrategy = home_strat;
+  awayStrategy = away_strat;
+  events.clear();
+  stats = {};
+  profile = {};
+  matchTimeMinutes = 0.0f;
+  tickCount = 0;
+  accumulator = 0.0f;
+  previousState = {};
+  homeScore = 0;
+  awayScore = 0;
+  recorder = nullptr;
+  heatmaps = nullptr;
+  uncontestedMinutes = 0.0f;
+
+  seedStreams(matchSeed);
+  setTickRate(DEFAULT_TICK_RATE);
   initializePlayers(home_lineup, true);
   initializePlayers(away_lineup, false);
+  buildFormation();
 
-  logEvent("Match started.");
+  recordEvent(MatchEventType::KICKOFF, true);
   resetPositions(false);  // Give Home team the kickoff
 }
 
+MatchEngine::MatchEngine(const MatchEngine& parent, ForkTag)
+    : players(parent.players),
+      kinematics(parent.kinematics),
+      ball(parent.ball),
+      formation(parent.formation),
+      carrierSlot(parent.carrierSlot),
+      statsConfig(parent.statsConfig),
+      homeStrategy(parent.homeStrategy),
+      awayStrategy(parent.awayStrategy),
+      stats(parent.stats),
+      matchTimeMinutes(parent.matchTimeMinutes),
+      tickCount(parent.tickCount),
+      tickRate(parent.tickRate),
+      fixedStep(parent.fixedStep),
+      accumulator(parent.accumulator),
+      ballRetentionPerTick(parent.ballRetentionPerTick),
+      previousState(parent.previousState),
+      homeScore(parent.homeScore),
+      awayScore(parent.awayScore),
+      seed(parent.seed),
+      decisionRng(parent.decisionRng),
+      tackleRng(parent.tackleRng)
+{
+}
+
 void MatchEngine::initializePlayers(const Lineup& lineup, bool isHomeTeam)
 {
   if (const Player* gk = lineup.getGoalkeeper())
@@ -55,11 +186,8 @@ void MatchEngine::initializePlayers(const Lineup& lineup, bool isHomeTeam)
     mp.isHomeTeam = isHomeTeam;
     mp.basePosition =
         isHomeTeam ? Vector2F{0.05f, 0.5f} : Vector2F{0.95f, 0.5f};
-    mp.position = mp.basePosition;
-    mp.velocity = {0.0f, 0.0f};
-    mp.maxSpeed = 0.05f;  // GK is slower
-    mp.acceleration = 0.1f;
-    players.push_back(mp);
+    mp.attributes = MatchAttributes::fromPlayer(*gk, *statsConfig);
+    addPlayer(mp, 0.05f, 0.1f);  // GK is slower
   }
 
   for (const auto& posPlayer : lineup.getOutfieldPlayers())
@@ -82,60 +210,310 @@ void MatchEngine::initializePlayers(const Lineup& lineup, bool isHomeTeam)
       mp.basePosition = {1.0f - px, 1.0f - py};
     }
 
-    mp.position = mp.basePosition;
-    mp.velocity = {0.0f, 0.0f};
-
     // Scale speed by stats (make stats matter much more)
-    float ovr = mp.player->getOverall(statsConfig) / 100.0f;
-    mp.maxSpeed = 0.05f + ovr * 0.15f;
-    mp.acceleration = 0.1f + ovr * 0.2f;
+    mp.attributes = MatchAttributes::fromPlayer(*mp.player, *statsConfig);
+    addPlayer(mp, mp.attributes.maxSpeed(), mp.attributes.acceleration());
+  }
+}
 
-    players.push_back(mp);
+void MatchEngine::addPlayer(const MatchPlayer& mp, float maxSpeed,
+                            float acceleration)
+{
+  if (kinematics.add(mp.basePosition, maxSpeed, acceleration) ==
+      MatchKinematics::CAPACITY)
+  {
+    return;  // More players than a match can hold
   }
+  players.push_back(mp);
+  addStatLine(players.size() - 1);
+}
+
+void MatchEngine::addStatLine(size_t slot)
+{
+  // Past the limit, a substitute adds to the line of the player it replaced
+  if (stats.playerCount == MatchStats::MAX_PLAYERS) return;
+  stats.lineOfSlot[slot] = static_cast<uint8_t>(stats.playerCount);
+  stats.players[stats.playerCount++].player = players[slot].player->getId();
+}
+
+MatchStatLine& MatchEngine::statLine(size_t slot)
+{
+  return stats.players[stats.lineOfSlot[slot]];
 }
 
 void MatchEngine::substitutePlayer(uint32_t outPlayerId, const Player* inPlayer)
 {
-  for (auto& mp : players)
+  for (size_t i = 0; i < players.size(); ++i)
   {
-    if (mp.player && mp.player->getId() == outPlayerId)
+    if (MatchPlayer& mp = players[i];
+        mp.player && mp.player->getId() == outPlayerId)
     {
       mp.player = inPlayer;
-      float ovr = inPlayer->getOverall(statsConfig) / 100.0f;
-      mp.maxSpeed = 0.05f + ovr * 0.15f;
-      mp.acceleration = 0.1f + ovr * 0.2f;
-      logEvent("Substitution: " + inPlayer->getName() + " comes on.");
-
-      if (ball.possessedBy && ball.possessedBy->getId() == outPlayerId)
-      {
-        ball.possessedBy = nullptr;  // Drop ball if subbed while possessing
-      }
+      mp.attributes = MatchAttributes::fromPlayer(*inPlayer, *statsConfig);
+      kinematics.maxSpeed[i] = mp.attributes.maxSpeed();
+      kinematics.accel[i] = mp.attributes.acceleration();
+      addStatLine(i);
+      buildFormation();
+      recordEvent(MatchEventType::SUBSTITUTION, mp.isHomeTeam, inPlayer);
+
+      // Drop ball if subbed while possessing
+      const bool subbedCarrier =
+          ball.possessedBy && ball.possessedBy->getId() == outPlayerId;
+      setCarrier(subbedCarrier ? nullptr : ball.possessedBy);
       break;
     }
   }
 }
 
+void MatchEngine::seedStreams(uint64_t matchSeed)
+{
+  seed = matchSeed;
+  const RandomStream root(matchSeed);
+  decisionRng = root.split(static_cast<uint64_t>(RngStream::DECISION));
+  tackleRng = root.split(static_cast<uint64_t>(RngStream::TACKLE));
+}
+
+void MatchEngine::simulateToEnd(uint64_t matchSeed, int ticksPerMinute)
+{
+  seedStreams(matchSeed);
+  setTickRate(ticksPerMinute);
+  uncontestedMinutes = 0.0f;
+
+  while (!isFinished())
+  {
+    step(fixedStep);
+  }
+}
+
+void MatchEngine::simulateRemaining(const std::function<bool(float)>& onMinute)
+{
+  accumulator = 0.0f;
+  while (!isFinished())
+  {
+    step(fixedStep);
+    if (onMinute && tickCount % static_cast<uint32_t>(tickRate) == 0 &&
+        !onMinute(matchTimeMinutes))
+    {
+      return;
+    }
+  }
+}
+
+MatchEngineSnapshot MatchEngine::snapshot() const
+{
+  MatchEngineSnapshot state;
+  state.players.reserve(players.size());
+  for (const MatchPlayer& mp : players)
+  {
+    state.players.push_back({mp.player->getId(), mp.isHomeTeam,
+                             mp.basePosition, mp.attributes,
+                             mp.tackleCooldown});
+  }
+  state.kinematics = kinematics;
+  state.previousState = previousState;
+  state.ballPosition = ball.position;
+  state.ballVelocity = ball.velocity;
+  state.possessedBy = ball.possessedBy ? ball.possessedBy->getId() : 0;
+  state.lastPossessor = ball.lastPossessor ? ball.lastPossessor->getId() : 0;
+  state.passCooldown = ball.passCooldown;
+  state.homeStrategy = homeStrategy;
+  state.awayStrategy = awayStrategy;
+  state.events.assign(events.view().begin(), events.view().end());
+  state.stats = stats;
+  state.matchTimeMinutes = matchTimeMinutes;
+  state.tickCount = tickCount;
+  state.tickRate = tickRate;
+  state.accumulator = accumulator;
+  state.homeScore = homeScore;
+  state.awayScore = awayScore;
+  state.seed = seed;
+  state.decisionPosition = decisionRng.getPosition();
+  state.tacklePosition = tackleRng.getPosition();
+  return state;
+}
+
+bool MatchEngine::restore(const MatchEngineSnapshot& state,
+                          const PlayerLookup& findPlayer)
+{
+  // Without a lookup, the snapshot can only refer to players this engine knows
+  auto find = [this, &findPlayer](PlayerID id) -> const Player*
+  {
+    if (findPlayer) return findPlayer(id);
+    for (const MatchPlayer& mp : players)
+    {
+      if (mp.player->getId() == id) return mp.player;
+    }
+    if (ball.lastPossessor && ball.lastPossessor->getId() == id)
+    {
+      return ball.lastPossessor;
+    }
+    return nullptr;
+  };
+
+  if (state.players.size() > MatchKinematics::CAPACITY) return false;
+
+  std::vector<MatchPlayer> restored;
+  restored.reserve(state.players.size());
+  for (const auto& ps : state.players)
+  {
+    const Player* player = find(ps.id);
+    if (!player) return false;
+    restored.push_back({player, ps.isHomeTeam, ps.basePosition, ps.attributes,
+                        ps.tackleCooldown});
+  }
+
+  const Player* possessedBy = nullptr;
+  const Player* lastPossessor = nullptr;
+  if (state.possessedBy != 0 && !(possessedBy = find(state.possessedBy)))
+  {
+    return false;
+  }
+  if (state.lastPossessor != 0 && !(lastPossessor = find(state.lastPossessor)))
+  {
+    return false;
+  }
+
+  players = std::move(restored);
+  kinematics = state.kinematics;
+  ball.position = state.ballPosition;
+  ball.velocity = state.ballVelocity;
+  ball.lastPossessor = lastPossessor;
+  ball.passCooldown = state.passCooldown;
+  homeStrategy = state.homeStrategy;
+  awayStrategy = state.awayStrategy;
+  buildFormation();
+  setCarrier(possessedBy);
+  events.assign(state.events);
+  stats = state.stats;
+  matchTimeMinutes = state.matchTimeMinutes;
+  tickCount = state.tickCount;
+  homeScore = state.homeScore;
+  awayScore = state.awayScore;
+
+  seedStreams(state.seed);
+  decisionRng.seek(state.decisionPosition);
+  tackleRng.seek(state.tacklePosition);
+
+  setTickRate(state.tickRate);
+  accumulator = state.accumulator;
+  previousState = state.previousState;
+  return true;
+}
+
+MatchEngine MatchEngine::fork(std::optional<uint64_t> forkSeed) const
+{
+  MatchEngine branch(*this, ForkTag{});
+  if (forkSeed.has_value()) branch.seedStreams(*forkSeed);
+  return branch;
+}
+
+void MatchEngine::setRecorder(MatchReplayRecorder* replay_recorder)
+{
+  recorder = replay_recorder;
+  if (recorder) recorder->capture(*this);
+}
+
+void MatchEngine::setHeatmaps(MatchHeatmaps* player_heatmaps)
+{
+  heatmaps = player_heatmaps;
+}
+
+void MatchEngine::setStrategy(bool isHomeTeam, const Strategy& strategy)
+{
+  (isHomeTeam ? homeStrategy : awayStrategy) = strategy;
+  buildFormation();
+}
+
+void MatchEngine::setTickRate(int ticksPerMinute)
+{
+  tickRate = std::max(ticksPerMinute, 1);
+  fixedStep = 1.0f / static_cast<float>(tickRate);
+  accumulator = std::min(accumulator, fixedStep);
+  // Friction is tuned per default tick, rescale it so the ball slows down
+  // at the same rate per minute whatever the tick rate
+  ballRetentionPerTick =
+      tickRate == DEFAULT_TICK_RATE
+          ? ball.friction
+          : std::pow(ball.friction, static_cast<float>(DEFAULT_TICK_RATE) /
+                                        static_cast<float>(tickRate));
+}
+
 void MatchEngine::update(float deltaTime)
 {
-  if (matchTimeMinutes >= 90.0f) return;
+  if (isFinished()) return;
+
+  accumulator += deltaTime * TIME_SCALE / 60.0f;  // dt in minutes
+  while (accumulator >= fixedStep && !isFinished())
+  {
+    accumulator -= fixedStep;
+    step(fixedStep);
+  }
+  if (isFinished()) accumulator = 0.0f;
+}
+
+Vector2F MatchEngine::interpolatedPlayerPosition(size_t index) const
+{
+  const float alpha = getInterpolationAlpha();
+  return {std::lerp(previousState.x[index], kinematics.x[index], alpha),
+          std::lerp(previousState.y[index], kinematics.y[index], alpha)};
+}
+
+Vector2F MatchEngine::interpolatedBallPosition() const
+{
+  const float alpha = getInterpolationAlpha();
+  return {std::lerp(previousState.ball.x, ball.position.x, alpha),
+          std::lerp(previousState.ball.y, ball.position.y, alpha)};
+}
 
-  float simDt = deltaTime * TIME_SCALE / 60.0f;  // dt in minutes
-  matchTimeMinutes += simDt;
+void MatchEngine::captureState(MatchRenderState& state) const
+{
+  state.x = kinematics.x;
+  state.y = kinematics.y;
+  state.ball = ball.position;
+}
+
+void MatchEngine::step(float dt)
+{
+  beginTick(dt);
+  const uint64_t start = MatchProfile::now();
+  calculateForces(dt);
+  profile.addCycles(MatchProfile::FORCES, start);
+  endTick(dt);
+}
+
+void MatchEngine::beginTick(float dt)
+{
+  captureState(previousState);
+  matchTimeMinutes += dt;
+  ++tickCount;
 
   if (ball.passCooldown > 0.0f)
   {
-    ball.passCooldown -= deltaTime;
+    ball.passCooldown -= dt;
   }
+}
 
-  calculateForces(deltaTime);
-  resolvePossessionAndPassing(deltaTime);
+void MatchEngine::endTick(float dt)
+{
+  uint64_t start = MatchProfile::now();
+  resolvePossessionAndPassing(dt);
+  profile.addCycles(MatchProfile::POSSESSION, start);
+  start = MatchProfile::now();
   checkGoals();
+  profile.addCycles(MatchProfile::GOALS, start);
+  profile.countTick();
+  moveBall(dt);
 
-  // Update ball physics
-  ball.position.x += ball.velocity.x * deltaTime;
-  ball.position.y += ball.velocity.y * deltaTime;
-  ball.velocity.x *= ball.friction;
-  ball.velocity.y *= ball.friction;
+  if (heatmaps) heatmaps->accumulate(kinematics, stats, players.size());
+  if (recorder) recorder->capture(*this);
+}
+
+void MatchEngine::moveBall(float dt)
+{
+  ball.position.x += ball.velocity.x * dt;
+  ball.position.y += ball.velocity.y * dt;
+  ball.velocity.x *= ballRetentionPerTick;
+  ball.velocity.y *= ballRetentionPerTick;
 
   // Bounce ball off walls
   if (ball.position.x < 0.0f)
@@ -162,164 +540,131 @@ void MatchEngine::update(float deltaTime)
 
 void MatchEngine::calculateForces(float dt)
 {
-  for (auto& mp : players)
+  steerPlayers();
+  // Pull, pressing, repulsion and integration run vectorized over all players
+  kinematics.integrate(ball.position, dt);
+}
+
+void MatchEngine::buildFormation()
+{
+  for (size_t i = 0; i < players.size(); ++i)
+  {
+    const MatchPlayer& mp = players[i];
+    const StrategySliders& sliders = mp.isHomeTeam
+                                         ? homeStrategy.getSliders()
+                                         : awayStrategy.getSliders();
+
+    formation.keeper[i] = mp.player->getRole() == PlayerRole::GK;
+    formation.goalX[i] = mp.isHomeTeam ? 1.0f : 0.0f;
+    formation.keeperX[i] = mp.isHomeTeam ? 0.05f : 0.95f;
+    formation.keeperSpeed[i] = mp.attributes.maxSpeed();
+
+    // Attackers push forward and spread out vertically
+    Vector2F attack = mp.basePosition;
+    float pushAmount =
+        0.1f + sliders.riskTaking * 0.2f;  // Risk determines how far forward
+    attack.x += mp.isHomeTeam ? pushAmount : -pushAmount;
+    formation.attackX[i] = attack.x;
+    formation.attackY[i] = attack.y;
+    formation.spread[i] = 0.05f + sliders.widthUsage * 0.1f;
+
+    // Defenders drop back and squeeze the center
+    Vector2F defend = mp.basePosition;
+    float dropAmount =
+        0.05f + sliders.compactness * 0.15f;  // Compactness pulls them back
+    defend.x -= mp.isHomeTeam ? dropAmount : -dropAmount;
+    float squeeze = 0.02f + sliders.compactness * 0.08f;
+    if (defend.y > 0.5f + squeeze) defend.y -= squeeze;
+    if (defend.y < 0.5f - squeeze) defend.y += squeeze;
+    formation.defendX[i] = defend.x;
+    formation.defendY[i] = defend.y;
+
+    // High pressing = larger engage radius
+    formation.pressRadius[i] = 0.1f + sliders.pressing * 0.3f;
+    formation.pressAggression[i] = 0.5f + sliders.pressing * 1.0f;
+  }
+}
+
+void MatchEngine::setCarrier(const Player* player)
+{
+  if (player && player != ball.lastPossessor)
   {
-    Vector2F force = {0.0f, 0.0f};
+    profile.count(MatchProfile::POSSESSION_CHANGE);
+  }
+  ball.possessedBy = player;
+  carrierSlot = -1;
+  uncontestedMinutes = 0.0f;
+  if (!player) return;
+
+  auto it = std::ranges::find_if(players, [player](const MatchPlayer& p)
+                                 { return p.player == player; });
+  if (it != players.end()) carrierSlot = static_cast<int>(indexOf(*it));
+}
+
+void MatchEngine::steerPlayers()
+{
+  // Whichever team has the ball decides who attacks and who defends
+  const MatchPlayer* carrier =
+      carrierSlot >= 0 ? &players[static_cast<size_t>(carrierSlot)] : nullptr;
+  // Keepers follow the ball's y slightly
+  const float keeperY =
+      0.5f + std::clamp((ball.position.y - 0.5f) * 0.3f, -0.15f, 0.15f);
+
+  for (size_t i = 0; i < players.size(); ++i)
+  {
+    const MatchPlayer& mp = players[i];
+    Vector2F position = kinematics.position(i);
+
+    kinematics.steerX[i] = 0.0f;
+    kinematics.steerY[i] = 0.0f;
+    kinematics.pull[i] = 0.5f;
+    kinematics.pressRadius[i] = 0.0f;
+    kinematics.pressAggression[i] = 0.0f;
 
     if (ball.possessedBy == mp.player)
     {
       // Carrier runs towards opponent goal, drifting slightly towards center
-      Vector2F toGoal =
-          mp.isHomeTeam ? Vector2F{1.0f - mp.position.x, 0.5f - mp.position.y}
-                        : Vector2F{0.0f - mp.position.x, 0.5f - mp.position.y};
-      toGoal.y += (mp.position.y > 0.5f) ? -0.1f : 0.1f;
+      Vector2F toGoal = {formation.goalX[i] - position.x, 0.5f - position.y};
+      toGoal.y += (position.y > 0.5f) ? -0.1f : 0.1f;
 
       Vector2F normToGoal = normalize(toGoal);
-      force.x += normToGoal.x * 1.0f;
-      force.y += normToGoal.y * 1.0f;
+      kinematics.steerX[i] = normToGoal.x * 1.0f;
+      kinematics.steerY[i] = normToGoal.y * 1.0f;
+      kinematics.pull[i] = 0.0f;
+      kinematics.targetX[i] = position.x;
+      kinematics.targetY[i] = position.y;
+      continue;
     }
-    else
-    {
-      // Tactical Pull
-      Vector2F base = mp.basePosition;
-
-      bool teamHasBall = false;
-      if (ball.possessedBy)
-      {
-        auto it =
-            std::ranges::find_if(players, [this](const MatchPlayer& p)
-                                 { return p.player == ball.possessedBy; });
-        if (it != players.end() && it->isHomeTeam == mp.isHomeTeam)
-        {
-          teamHasBall = true;
-        }
-      }
-
-      if (teamHasBall)
-      {
-        // Attackers push forward and spread out vertically
-        if (mp.player->getRole() != PlayerRole::GK)
-        {
-          float risk = mp.isHomeTeam ? homeStrategy.getSliders().riskTaking
-                                     : awayStrategy.getSliders().riskTaking;
-          float pushAmount =
-              0.1f + risk * 0.2f;  // Risk determines how far forward they push
-
-          base.x += mp.isHomeTeam ? pushAmount : -pushAmount;
-
-          float width = mp.isHomeTeam ? homeStrategy.getSliders().widthUsage
-                                      : awayStrategy.getSliders().widthUsage;
-          float spread = (mp.position.y > 0.5f) ? (0.05f + width * 0.1f)
-                                                : -(0.05f + width * 0.1f);
-          base.y += spread;
-        }
-      }
-      else
-      {
-        // Defenders drop back and squeeze the center
-        if (mp.player->getRole() != PlayerRole::GK)
-        {
-          float compactness = mp.isHomeTeam
-                                  ? homeStrategy.getSliders().compactness
-                                  : awayStrategy.getSliders().compactness;
-          float dropAmount =
-              0.05f + compactness * 0.15f;  // Compactness pulls them back more
-
-          base.x -= mp.isHomeTeam ? dropAmount : -dropAmount;
-
-          float squeeze = 0.02f + compactness * 0.08f;
-          if (base.y > 0.5f + squeeze) base.y -= squeeze;
-          if (base.y < 0.5f - squeeze) base.y += squeeze;
-        }
-      }
-
-      // Goalkeeper logic
-      if (mp.player->getRole() == PlayerRole::GK)
-      {
-        float goalX = mp.isHomeTeam ? 0.05f : 0.95f;
-        base.x = goalX;
-        base.y = 0.5f;
 
-        // Follow ball y slightly
-        float dy = ball.position.y - 0.5f;
-        base.y += std::clamp(dy * 0.3f, -0.15f, 0.15f);
+    const bool teamHasBall = carrier && carrier->isHomeTeam == mp.isHomeTeam;
 
-        // If ball is loose or opponent has it, and it's close, rush out
-        float distToBall = distance(mp.position, ball.position);
-        if (!teamHasBall && distToBall < 0.15f)
-        {
-          base.x = ball.position.x;
-          base.y = ball.position.y;
-          mp.maxSpeed = 0.8f;  // Burst speed
-        }
-        else
-        {
-          float ovr = mp.player->getOverall(statsConfig) / 100.0f;
-          mp.maxSpeed = 0.05f + ovr * 0.15f;
-        }
-      }
-
-      Vector2F toBase = {base.x - mp.position.x, base.y - mp.position.y};
-      force.x += toBase.x * 0.5f;
-      force.y += toBase.y * 0.5f;
-
-      // Press the ball if opponent has it, or if it's loose
-      if (!teamHasBall && mp.player->getRole() != PlayerRole::GK)
-      {
-        Vector2F toBall = {ball.position.x - mp.position.x,
-                           ball.position.y - mp.position.y};
-        float distToBall = distance(mp.position, ball.position);
-
-        float pressing = mp.isHomeTeam ? homeStrategy.getSliders().pressing
-                                       : awayStrategy.getSliders().pressing;
-        float pressRadius =
-            0.1f + pressing * 0.3f;  // High pressing = larger engage radius
-
-        if (distToBall < pressRadius)
-        {
-          Vector2F normToBall = normalize(toBall);
-          float pressAggression = 0.5f + pressing * 1.0f;
-          force.x += normToBall.x * pressAggression;
-          force.y += normToBall.y * pressAggression;
-        }
-      }
+    if (formation.keeper[i])
+    {
+      // If ball is loose or opponent has it, and it's close, rush out
+      const bool rush = !teamHasBall &&
+                        distance(position, ball.position) < KEEPER_RUSH_RANGE;
+      kinematics.targetX[i] = rush ? ball.position.x : formation.keeperX[i];
+      kinematics.targetY[i] = rush ? ball.position.y : keeperY;
+      kinematics.maxSpeed[i] =
+          rush ? KEEPER_BURST_SPEED : formation.keeperSpeed[i];
+      continue;
     }
 
-    // 3. Repulsion from other players
-    for (const auto& other : players)
+    if (teamHasBall)
     {
-      if (&other == &mp) continue;
-      Vector2F toOther = {other.position.x - mp.position.x,
-                          other.position.y - mp.position.y};
-      float dist = distance(mp.position, other.position);
-      if (dist < 0.05f && dist > 0.001f)
-      {
-        Vector2F normToOther = normalize(toOther);
-        force.x -= normToOther.x * (0.05f - dist) * 10.0f;
-        force.y -= normToOther.y * (0.05f - dist) * 10.0f;
-      }
+      const float spread = formation.spread[i];
+      kinematics.targetX[i] = formation.attackX[i];
+      kinematics.targetY[i] =
+          formation.attackY[i] + ((position.y > 0.5f) ? spread : -spread);
     }
-
-    // Apply force to velocity
-    mp.velocity.x += force.x * mp.acceleration * dt;
-    mp.velocity.y += force.y * mp.acceleration * dt;
-
-    // Clamp velocity to max speed
-    if (float speed = std::sqrt(mp.velocity.x * mp.velocity.x +
-                                mp.velocity.y * mp.velocity.y);
-        speed > mp.maxSpeed)
+    else
     {
-      mp.velocity.x = (mp.velocity.x / speed) * mp.maxSpeed;
-      mp.velocity.y = (mp.velocity.y / speed) * mp.maxSpeed;
+      // Press the ball if opponent has it, or if it's loose
+      kinematics.targetX[i] = formation.defendX[i];
+      kinematics.targetY[i] = formation.defendY[i];
+      kinematics.pressRadius[i] = formation.pressRadius[i];
+      kinematics.pressAggression[i] = formation.pressAggression[i];
     }
-
-    // Update position
-    mp.position.x += mp.velocity.x * dt;
-    mp.position.y += mp.velocity.y * dt;
-
-    // Clamp position to pitch
-    mp.position.x = std::clamp(mp.position.x, 0.0f, 1.0f);
-    mp.position.y = std::clamp(mp.position.y, 0.0f, 1.0f);
   }
 }
 
@@ -328,48 +673,60 @@ void MatchEngine::resolvePossessionAndPassing(float dt)
   if (ball.possessedBy)
   {
     // Make the ball stick to the possessing player
-    auto it = std::ranges::find_if(players, [this](const MatchPlayer& mp)
-                                   { return mp.player == ball.possessedBy; });
-    if (it != players.end())
+    if (carrierSlot >= 0)
     {
-      ball.position = it->position;
+      const auto slot = static_cast<size_t>(carrierSlot);
+      const MatchPlayer& carrier = players[slot];
+      const Vector2F carrierPos = positionOf(carrier);
+      ball.position = carrierPos;
       ball.velocity = {0.0f, 0.0f};
 
-      // Random passing logic
-      static std::mt19937 rng(42);
-      std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+      MatchStatLine& team = stats.team(carrier.isHomeTeam);
+      statLine(slot).possessionMinutes += dt;
+      team.possessionMinutes += dt;
 
+      // Random passing logic
       // Decision making based on time, not frames. Roughly 1 action every 2 sim
       // seconds.
-      if (dist(rng) < 0.5f * dt)
+      if (decisionRng.uniform() < 0.5f * dt)
       {
-        bool isHome = it->isHomeTeam;
+        bool isHome = carrier.isHomeTeam;
         float distToGoal = distance(
-            it->position, isHome ? Vector2F{1.0f, 0.5f} : Vector2F{0.0f, 0.5f});
+            carrierPos, isHome ? Vector2F{1.0f, 0.5f} : Vector2F{0.0f, 0.5f});
 
-        if (distToGoal < 0.15f || (distToGoal < 0.25f && dist(rng) < 0.2f))
+        if (distToGoal < 0.15f ||
+            (distToGoal < LONG_SHOT_RANGE && decisionRng.uniform() < 0.2f))
         {
           // Shoot! (Must be close to goal, or occasionally a long shot)
           ball.lastPossessor = ball.possessedBy;
           ball.passCooldown = 0.5f;
-          ball.possessedBy = nullptr;
+          setCarrier(nullptr);
 
           Vector2F toGoal =
-              isHome ? Vector2F{1.0f - it->position.x, 0.5f - it->position.y}
-                     : Vector2F{0.0f - it->position.x, 0.5f - it->position.y};
+              isHome ? Vector2F{1.0f - carrierPos.x, 0.5f - carrierPos.y}
+                     : Vector2F{0.0f - carrierPos.x, 0.5f - carrierPos.y};
           Vector2F norm = normalize(toGoal);
 
-          float ovr = it->player->getOverall(statsConfig) / 100.0f;
+          float ovr = carrier.attributes.overall;
           // Add inaccuracy
           float errorMargin = 0.3f - ovr * 0.25f;
-          norm.y += (dist(rng) - 0.5f) * errorMargin;
-          norm.x += (dist(rng) - 0.5f) * (errorMargin * 0.5f);
+          norm.y += (decisionRng.uniform() - 0.5f) * errorMargin;
+          norm.x += (decisionRng.uniform() - 0.5f) * (errorMargin * 0.5f);
           norm = normalize(norm);
 
           // Scale shot power
           float shotSpeed = 1.0f + ovr * 0.5f;
           ball.velocity = {norm.x * shotSpeed, norm.y * shotSpeed};
-          logEvent(it->player->getName() + " shoots!");
+
+          const bool onTarget = isShotOnTarget(isHome);
+          const float xg = MatchStats::shotExpectedGoals(distToGoal);
+          for (MatchStatLine* line : {&statLine(slot), &team})
+          {
+            line->shots++;
+            line->shotsOnTarget += onTarget ? 1 : 0;
+            line->expectedGoals += xg;
+          }
+          recordEvent(MatchEventType::SHOT, isHome, carrier.player);
         }
         else
         {
@@ -378,15 +735,15 @@ void MatchEngine::resolvePossessionAndPassing(float dt)
           float bestScore = -1.0f;
           for (const auto& other : players)
           {
-            if (other.isHomeTeam == isHome && other.player != it->player)
+            if (other.isHomeTeam == isHome && other.player != carrier.player)
             {
-              float dx = isHome ? (other.position.x - it->position.x)
-                                : (it->position.x - other.position.x);
+              float dx = isHome ? (positionOf(other).x - carrierPos.x)
+                                : (carrierPos.x - positionOf(other).x);
 
               // Prefer players who are ahead or slightly sideways
               if (dx > -0.1f)
               {
-                float d = distance(it->position, other.position);
+                float d = distance(carrierPos, positionOf(other));
                 if (d > 0.1f && d < 0.5f)
                 {
                   // Score based on distance and how far forward they are
@@ -404,25 +761,30 @@ void MatchEngine::resolvePossessionAndPassing(float dt)
           {
             ball.lastPossessor = ball.possessedBy;
             ball.passCooldown = 0.5f;
-            ball.possessedBy = nullptr;
+            setCarrier(nullptr);
 
             // Lead the pass slightly
+            const Vector2F targetPos = positionOf(*target);
+            const Vector2F targetVel = velocityOf(*target);
             Vector2F toTarget = {
-                target->position.x + target->velocity.x * 0.5f - it->position.x,
-                target->position.y + target->velocity.y * 0.5f -
-                    it->position.y};
+                targetPos.x + targetVel.x * 0.5f - carrierPos.x,
+                targetPos.y + targetVel.y * 0.5f - carrierPos.y};
             Vector2F norm = normalize(toTarget);
 
-            float ovr = it->player->getOverall(statsConfig) / 100.0f;
+            float ovr = carrier.attributes.overall;
             float errorMargin = 0.2f - ovr * 0.15f;
-            norm.y += (dist(rng) - 0.5f) * errorMargin;
-            norm.x += (dist(rng) - 0.5f) * (errorMargin * 0.5f);
+            norm.y += (decisionRng.uniform() - 0.5f) * errorMargin;
+            norm.x += (decisionRng.uniform() - 0.5f) * (errorMargin * 0.5f);
             norm = normalize(norm);
 
             float passSpeed = 0.8f + ovr * 0.4f;
             ball.velocity = {norm.x * passSpeed, norm.y * passSpeed};
-            logEvent(it->player->getName() + " passes to " +
-                     target->player->getName());
+
+            statLine(slot).passesAttempted++;
+            team.passesAttempted++;
+            stats.passingSlot = static_cast<int>(slot);
+            recordEvent(MatchEventType::PASS, isHome, carrier.player,
+                        target->player);
           }
         }
       }
@@ -443,7 +805,7 @@ void MatchEngine::resolvePossessionAndPassing(float dt)
       }
       if (ball.passCooldown > 0.0f && mp.player == ball.lastPossessor) continue;
 
-      float dist = distance(mp.position, ball.position);
+      float dist = distance(positionOf(mp), ball.position);
       if (dist < minDist)
       {
         minDist = dist;
@@ -453,54 +815,79 @@ void MatchEngine::resolvePossessionAndPassing(float dt)
 
     if (closest)
     {
-      ball.possessedBy = closest->player;
+      setCarrier(closest->player);
       ball.lastPossessor = closest->player;
       ball.passCooldown = 0.0f;
-      logEvent(closest->player->getName() + " controls the ball.");
+
+      // A pass is completed once a teammate of the passer controls it
+      const auto passer = static_cast<size_t>(stats.passingSlot);
+      if (stats.passingSlot >= 0 && passer != indexOf(*closest) &&
+          players[passer].isHomeTeam == closest->isHomeTeam)
+      {
+        statLine(passer).passesCompleted++;
+        stats.team(closest->isHomeTeam).passesCompleted++;
+      }
+      stats.passingSlot = -1;
+      recordEvent(MatchEventType::CONTROL, closest->isHomeTeam,
+                  closest->player);
     }
   }
 
   // Tackle logic: If an opponent is very close to the ball carrier, they can
-  // try to tackle
-  if (ball.possessedBy)
+  // try to tackle. Until uncontestedMinutes run out none can be, so the
+  // checks would draw nothing and are skipped.
+  if (carrierSlot < 0) return;
+  uncontestedMinutes -= dt;
+  if (uncontestedMinutes > 0.0f) return;
+
+  // A keeper's top speed rises to the burst speed once it rushes out, which
+  // can start at any tick of the skipped window
+  auto topSpeed = [this](size_t i)
   {
-    auto carrierIt =
-        std::ranges::find_if(players, [this](const MatchPlayer& mp)
-                             { return mp.player == ball.possessedBy; });
-    if (carrierIt != players.end())
+    return formation.keeper[i]
+               ? std::max(formation.keeperSpeed[i], KEEPER_BURST_SPEED)
+               : kinematics.maxSpeed[i];
+  };
+  MatchPlayer& carrier = players[static_cast<size_t>(carrierSlot)];
+  const Vector2F carrierPos = positionOf(carrier);
+  const float carrierSpeed = topSpeed(indexOf(carrier));
+  float horizon = MATCH_LENGTH_MINUTES;
+
+  for (const auto& defender : players)
+  {
+    if (defender.isHomeTeam == carrier.isHomeTeam) continue;
+
+    // Both players close in at top speed at most, the margin covers rounding
+    float dist = distance(positionOf(defender), carrierPos);
+    const float closing = carrierSpeed + topSpeed(indexOf(defender));
+    horizon =
+        std::min(horizon, (dist - TACKLE_RANGE - CONTEST_MARGIN) / closing);
+
+    if (defender.tackleCooldown > 0.0f) continue;
+    if (dist < TACKLE_RANGE)
     {
-      for (const auto& defender : players)
-      {
-        if (defender.isHomeTeam == carrierIt->isHomeTeam) continue;
-        if (defender.tackleCooldown > 0.0f) continue;
-
-        float dist = distance(defender.position, carrierIt->position);
-        if (dist < 0.04f)
-        {  // Tackle range
-          static std::mt19937 rng(1337);
-          std::uniform_real_distribution<float> distRand(0.0f, 1.0f);
-
-          float defOvr = defender.player->getOverall(statsConfig) / 100.0f;
-          float atkOvr = carrierIt->player->getOverall(statsConfig) / 100.0f;
-
-          // Base tackle success rate modified by stats difference
-          float tackleChance = 0.3f + (defOvr - atkOvr) * 0.5f;
-          tackleChance = std::clamp(tackleChance, 0.05f, 0.8f);
-
-          if (distRand(rng) < tackleChance * dt * 2.0f)
-          {  // Tackle check over time
-            ball.possessedBy = defender.player;
-            ball.lastPossessor = defender.player;
-            ball.passCooldown = 0.5f;
-            carrierIt->tackleCooldown = 1.0f;  // Carrier is stunned briefly
-            logEvent(defender.player->getName() + " tackles the ball from " +
-                     carrierIt->player->getName() + "!");
-            break;
-          }
-        }
+      float defOvr = defender.attributes.overall;
+      float atkOvr = carrier.attributes.overall;
+
+      // Base tackle success rate modified by stats difference
+      float tackleChance = 0.3f + (defOvr - atkOvr) * 0.5f;
+      tackleChance = std::clamp(tackleChance, 0.05f, 0.8f);
+
+      if (tackleRng.uniform() < tackleChance * dt * 2.0f)
+      {  // Tackle check over time
+        setCarrier(defender.player);
+        ball.lastPossessor = defender.player;
+        ball.passCooldown = 0.5f;
+        carrier.tackleCooldown = 1.0f;  // Carrier is stunned briefly
+        statLine(indexOf(defender)).tackles++;
+        stats.team(defender.isHomeTeam).tackles++;
+        recordEvent(MatchEventType::TACKLE, defender.isHomeTeam,
+                    defender.player, carrier.player);
+        return;
       }
     }
   }
+  uncontestedMinutes = horizon;
 }
 
 void MatchEngine::checkGoals()
@@ -508,13 +895,13 @@ void MatchEngine::checkGoals()
   if (ball.position.x >= 0.99f && std::abs(ball.position.y - 0.5f) < 0.1f)
   {
     homeScore++;
-    logEvent("GOAL for Home Team!");
+    recordEvent(MatchEventType::GOAL, true, ball.lastPossessor);
     resetPositions(false);
   }
   else if (ball.position.x <= 0.01f && std::abs(ball.position.y - 0.5f) < 0.1f)
   {
     awayScore++;
-    logEvent("GOAL for Away Team!");
+    recordEvent(MatchEventType::GOAL, false, ball.lastPossessor);
     resetPositions(true);
   }
 }
@@ -523,23 +910,26 @@ void MatchEngine::resetPositions(bool homeConceded)
 {
   ball.position = {0.5f, 0.5f};
   ball.velocity = {0.0f, 0.0f};
-  ball.possessedBy = nullptr;
+  setCarrier(nullptr);
+  stats.passingSlot = -1;
 
-  for (auto& mp : players)
+  for (size_t i = 0; i < players.size(); ++i)
   {
-    mp.position = mp.basePosition;
+    const MatchPlayer& mp = players[i];
+    Vector2F position = mp.basePosition;
 
     // Ensure players start in their own half
-    if (mp.isHomeTeam && mp.position.x > 0.49f)
+    if (mp.isHomeTeam && position.x > 0.49f)
     {
-      mp.position.x = 0.49f;
+      position.x = 0.49f;
     }
-    if (!mp.isHomeTeam && mp.position.x < 0.51f)
+    if (!mp.isHomeTeam && position.x < 0.51f)
     {
-      mp.position.x = 0.51f;
+      position.x = 0.51f;
     }
 
-    mp.velocity = {0.0f, 0.0f};
+    kinematics.setPosition(i, position);
+    kinematics.setVelocity(i, {0.0f, 0.0f});
   }
 
   bool teamToStart = homeConceded ? true : false;
@@ -550,7 +940,7 @@ void MatchEngine::resetPositions(bool homeConceded)
   {
     if (mp.isHomeTeam == teamToStart && mp.player->getRole() != PlayerRole::GK)
     {
-      float d = distance(mp.position, ball.position);
+      float d = distance(positionOf(mp), ball.position);
       if (d < minDist)
       {
         minDist = d;
@@ -561,17 +951,61 @@ void MatchEngine::resetPositions(bool homeConceded)
 
   if (closest)
   {
-    ball.possessedBy = closest->player;
-    closest->position = ball.position;  // Move them to the center to kick off
+    setCarrier(closest->player);
+    // Move them to the center to kick off
+    kinematics.setPosition(indexOf(*closest), ball.position);
+  }
+
+  // Players teleport to their kickoff spots, do not interpolate the jump
+  captureState(previousState);
+}
+
+size_t MatchEngine::indexOf(const MatchPlayer& mp) const
+{
+  return static_cast<size_t>(&mp - players.data());
+}
+
+Vector2F MatchEngine::positionOf(const MatchPlayer& mp) const
+{
+  return kinematics.position(indexOf(mp));
+}
+
+Vector2F MatchEngine::velocityOf(const MatchPlayer& mp) const
+{
+  return kinematics.velocity(indexOf(mp));
+}
+
+bool MatchEngine::isShotOnTarget(bool isHomeTeam) const
+{
+  // Where the ball's straight path crosses the goal line checkGoals() uses
+  const float lineX = isHomeTeam ? 0.99f : 0.01f;
+  if (isHomeTeam ? ball.velocity.x <= 0.0f : ball.velocity.x >= 0.0f)
+  {
+    return false;
   }
+  const float t =
+      std::max((lineX - ball.position.x) / ball.velocity.x, 0.0f);
+  return std::abs(ball.position.y + ball.velocity.y * t - 0.5f) < 0.1f;
 }
 
-void MatchEngine::logEvent(const std::string& msg)
+void MatchEngine::recordEvent(MatchEventType type, bool isHomeTeam,
+                              const Player* actor, const Player* target)
 {
-  events.emplace_back(matchTimeMinutes, msg);
-  // Keep only last 10 events
-  if (events.size() > 10)
+  events.push({type, tickCount, matchTimeMinutes, actor ? actor->getId() : 0,
+               target ? target->getId() : 0, ball.position, isHomeTeam});
+
+  switch (type)
   {
-    events.erase(events.begin());
+    case MatchEventType::PASS:
+      profile.count(MatchProfile::PASS);
+      break;
+    case MatchEventType::TACKLE:
+      profile.count(MatchProfile::TACKLE);
+      break;
+    case MatchEventType::GOAL:  // Every goal is followed by a kickoff
+      profile.count(MatchProfile::GOAL_RESET);
+      break;
+    default:
+      break;
   }
 }
@@ -8,33 +8,74 @@
 
 #pragma once
 
-#include <string>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
 #include <vector>
 
+#include "global/random_stream.h"
 #include "global/stats_config.h"
 #include "global/types.h"
 #include "model/lineup.h"
+#include "model/match_kinematics.h"
+#include "model/match_profile.h"
 #include "model/strategy.h"
 
+class MatchReplayRecorder;
+struct MatchHeatmaps;
+
+/**
+ * @struct MatchAttributes
+ * @brief Player ratings frozen at kickoff (or substitution), scaled to
+ * [0.0, 1.0], so the engine never touches the player's stat map per tick.
+ */
+struct MatchAttributes
+{
+  float overall = 0.0f;
+  float pace = 0.0f;
+  float passing = 0.0f;
+  float shooting = 0.0f;
+  float defending = 0.0f;
+  float goalkeeping = 0.0f;
+
+  static MatchAttributes fromPlayer(const Player& player,
+                                    const StatsConfig& config);
+
+  /** @brief Kinematic limits at kickoff, in pitch units per minute. */
+  float maxSpeed() const;
+  float acceleration() const;
+};
+
+// Position, velocity and speed limits live in MatchKinematics at the same
+// index as the MatchPlayer.
 struct MatchPlayer
 {
   const Player* player;
   bool isHomeTeam;
-  Vector2F position;      // Current actual position on the pitch [0.0, 1.0]
-  Vector2F velocity;      // Current movement vector
   Vector2F basePosition;  // Assigned tactical position [0.0, 1.0]
-
-  // Physics properties derived from stats
-  float maxSpeed;
-  float acceleration;
+  MatchAttributes attributes;
   float tackleCooldown = 0.0f;
 };
 
+/**
+ * @struct MatchRenderState
+ * @brief Positions captured at a tick boundary, used to interpolate rendering
+ * between two fixed simulation ticks.
+ */
+struct MatchRenderState
+{
+  alignas(32) std::array<float, MatchKinematics::CAPACITY> x{};
+  alignas(32) std::array<float, MatchKinematics::CAPACITY> y{};
+  Vector2F ball = {0.5f, 0.5f};
+};
+
 struct MatchBall
 {
   Vector2F position = {0.5f, 0.5f};
   Vector2F velocity = {0.0f, 0.0f};
-  float friction = 0.98f;
+  float friction = 0.98f;  // Velocity kept per 1/DEFAULT_TICK_RATE minute
 
   // Possession info
   const Player* possessedBy = nullptr;
@@ -42,55 +83,471 @@ struct MatchBall
   float passCooldown = 0.0f;
 };
 
+/**
+ * @struct MatchFormation
+ * @brief Tactical target of every player slot for both possession states.
+ *
+ * The targets only depend on the base positions, roles and strategy sliders,
+ * so they are worked out at kickoff and whenever one of those changes; each
+ * tick only picks the column of the team's possession state.
+ */
+struct MatchFormation
+{
+  using Slots = std::array<float, MatchKinematics::CAPACITY>;
+
+  alignas(32) Slots attackX{};  // Target while the team has the ball
+  alignas(32) Slots attackY{};
+  alignas(32) Slots spread{};   // Sideways, away from the middle of the pitch
+  alignas(32) Slots defendX{};  // Target otherwise
+  alignas(32) Slots defendY{};
+  alignas(32) Slots pressRadius{};
+  alignas(32) Slots pressAggression{};
+  alignas(32) Slots goalX{};    // Goal the slot runs at with the ball
+  alignas(32) Slots keeperX{};  // Line a keeper holds
+  alignas(32) Slots keeperSpeed{};
+  std::array<bool, MatchKinematics::CAPACITY> keeper{};
+};
+
+/**
+ * @enum MatchEventType
+ * @brief Kind of action recorded in the match event stream.
+ */
+enum class MatchEventType : uint8_t
+{
+  KICKOFF,      /*!< Match started */
+  SUBSTITUTION, /*!< Actor came on */
+  SHOT,         /*!< Actor shot at goal */
+  PASS,         /*!< Actor passed to target */
+  CONTROL,      /*!< Actor took control of a loose ball */
+  TACKLE,       /*!< Actor won the ball from target */
+  GOAL          /*!< Goal for the isHomeTeam side, actor touched it last */
+};
+
+/**
+ * @struct MatchEvent
+ * @brief Plain record of a match action. Text is only produced by the views
+ * that display it, so recording an event never allocates beyond the
+ * engine's event buffer.
+ */
 struct MatchEvent
 {
-  float timeMinute;
-  std::string description;
+  MatchEventType type;
+  uint32_t tick;     /*!< Engine tick the event happened in */
+  float timeMinute;  /*!< Match clock at that tick */
+  PlayerID actor;    /*!< 0 if no player is involved */
+  PlayerID target;   /*!< 0 if the event has no second player */
+  Vector2F position; /*!< Ball position */
+  bool isHomeTeam;   /*!< Side of the actor, or of the scoring team */
+};
+
+/**
+ * @class MatchEventLog
+ * @brief Fixed-size arena for the events of a match, allocated once with the
+ * engine and kept across reset(), so recording never allocates.
+ *
+ * A match records about a hundred events, far below CAPACITY. Should one
+ * overflow it anyway, the oldest half is discarded in place, keeping the
+ * latest events for the views and the storage contiguous.
+ */
+class MatchEventLog
+{
+ public:
+  static constexpr size_t CAPACITY = 512;
+
+  MatchEventLog() : storage(CAPACITY) {}
+
+  void push(const MatchEvent& event);
+  void clear() { count = 0; }
+
+  /** @brief Replaces the log with @p events, or their latest CAPACITY. */
+  void assign(std::span<const MatchEvent> events);
+
+  /** @brief The kept events, oldest first. */
+  std::span<const MatchEvent> view() const { return {storage.data(), count}; }
+
+ private:
+  std::vector<MatchEvent> storage;  // Always CAPACITY long
+  size_t count = 0;
+};
+
+/**
+ * @struct MatchStatLine
+ * @brief Running totals of one team or one player over a match.
+ */
+struct MatchStatLine
+{
+  PlayerID player = 0;             /*!< 0 on a team line */
+  float possessionMinutes = 0.0f;  /*!< Match time spent on the ball */
+  uint16_t shots = 0;
+  uint16_t shotsOnTarget = 0;      /*!< Shots struck between the posts */
+  uint16_t passesAttempted = 0;
+  uint16_t passesCompleted = 0;    /*!< Passes next controlled by a teammate */
+  uint16_t tackles = 0;            /*!< Tackles won */
+  float expectedGoals = 0.0f;      /*!< Sum of the xG of the shots */
+};
+
+/**
+ * @struct MatchStats
+ * @brief Team and player statistics, kept up to date by the engine while the
+ * match is played. Fixed size, so tracking them never allocates.
+ */
+struct MatchStats
+{
+  /** @brief Player lines kept, for starters and substitutes alike. */
+  static constexpr size_t MAX_PLAYERS = 40;
+
+  MatchStatLine home;
+  MatchStatLine away;
+  std::array<MatchStatLine, MAX_PLAYERS> players{};
+  size_t playerCount = 0;
+
+  // Engine bookkeeping: the line of each player slot, and the slot whose
+  // pass is still travelling or -1
+  std::array<uint8_t, MatchKinematics::CAPACITY> lineOfSlot{};
+  int passingSlot = -1;
+
+  const MatchStatLine& team(bool isHomeTeam) const
+  {
+    return isHomeTeam ? home : away;
+  }
+  MatchStatLine& team(bool isHomeTeam) { return isHomeTeam ? home : away; }
+
+  /** @brief The line of a player, or null if the player did not take part. */
+  const MatchStatLine* forPlayer(PlayerID id) const;
+
+  /** @brief Share of the time on the ball, even before anyone had it. */
+  float possessionShare(bool isHomeTeam) const;
+
+  /**
+   * @brief Chance that a shot from @p distance to the goal center scores,
+   * fitted to the shots of full engine runs.
+   */
+  static float shotExpectedGoals(float distance);
+};
+
+/**
+ * @struct MatchEngineSnapshot
+ * @brief Complete state of a match in progress as plain data.
+ *
+ * Players are referred to by id instead of pointer, so a snapshot stays valid
+ * after the engine is gone and can be stored alongside a save. Random streams
+ * are kept as the match seed and the position of each stream.
+ */
+struct MatchEngineSnapshot
+{
+  struct PlayerState
+  {
+    PlayerID id;
+    bool isHomeTeam;
+    Vector2F basePosition;
+    MatchAttributes attributes;
+    float tackleCooldown;
+  };
+
+  std::vector<PlayerState> players;
+  MatchKinematics kinematics;
+  MatchRenderState previousState;
+  Vector2F ballPosition;
+  Vector2F ballVelocity;
+  PlayerID possessedBy = 0; /*!< 0 if the ball is loose */
+  PlayerID lastPossessor = 0;
+  float passCooldown = 0.0f;
+  Strategy homeStrategy;
+  Strategy awayStrategy;
+  std::vector<MatchEvent> events;
+  MatchStats stats;
+
+  float matchTimeMinutes = 0.0f;
+  uint32_t tickCount = 0;
+  int tickRate = 0;
+  float accumulator = 0.0f;
+  int homeScore = 0;
+  int awayScore = 0;
+
+  uint64_t seed = 0;
+  uint64_t decisionPosition = 0;
+  uint64_t tacklePosition = 0;
 };
 
 class MatchEngine
 {
  public:
+  /** @brief Default number of fixed simulation ticks per match minute. */
+  static constexpr int DEFAULT_TICK_RATE = 20;
+
+  /** @brief Length of a match in simulated minutes. */
+  static constexpr float MATCH_LENGTH_MINUTES = 90.0f;
+
+  /** @brief Seed used when the caller does not provide one. */
+  static constexpr uint64_t DEFAULT_SEED = 42;
+
+  /** @brief Distance at which a keeper rushes out at a loose ball. */
+  static constexpr float KEEPER_RUSH_RANGE = 0.15f;
+
+  /** @brief Top speed of a keeper rushing out. */
+  static constexpr float KEEPER_BURST_SPEED = 0.8f;
+
+  /**
+   * @param seed Seed for the engine's random streams. Engines built from the
+   * same inputs and seed play out identically, independently of any other
+   * engine running at the same time.
+   */
   MatchEngine(const Lineup& home_lineup, const Lineup& away_lineup,
               const Strategy& home_strat, const Strategy& away_strat,
-              const StatsConfig& config);
+              const StatsConfig& config, uint64_t seed = DEFAULT_SEED);
+
+  /**
+   * @brief Starts a new match in this engine, exactly as if it had just been
+   * constructed from the same arguments.
+   *
+   * The player and event lists are cleared rather than freed, so an engine
+   * reused for matches of the same size allocates nothing. The replay
+   * recorder and heatmaps are detached.
+   */
+  void reset(const Lineup& home_lineup, const Lineup& away_lineup,
+             const Strategy& home_strat, const Strategy& away_strat,
+             const StatsConfig& config, uint64_t seed = DEFAULT_SEED);
 
+  /**
+   * @brief Advances the match clock by @p deltaTime minutes.
+   *
+   * Time is accumulated and the simulation advances in fixed ticks of
+   * 1/tickRate minutes, so outcomes do not depend on the caller's frame rate
+   * and a playback speed of N runs exactly N times as many ticks. Time left
+   * over after the last whole tick carries over to the next call.
+   */
   void update(float deltaTime);
 
+  /**
+   * @brief Sets the number of fixed ticks per simulated minute.
+   * @param ticksPerMinute Values below 1 are clamped to 1.
+   */
+  void setTickRate(int ticksPerMinute);
+  int getTickRate() const { return tickRate; }
+
+  /** @brief Length of one fixed tick in match minutes. */
+  float getFixedStep() const { return fixedStep; }
+
+  /**
+   * @brief Runs the match to the final whistle without any rendering.
+   *
+   * The engine's streams are reseeded with @p seed before the first tick, so
+   * the same lineups, strategies and seed always produce the same result.
+   *
+   * @param seed Seed for the engine's random streams.
+   * @param ticksPerMinute Number of fixed ticks per simulated minute.
+   */
+  void simulateToEnd(uint64_t seed, int ticksPerMinute = DEFAULT_TICK_RATE);
+
+  /**
+   * @brief Plays the rest of a live match without any rendering.
+   *
+   * The random streams are not reseeded, so the match ends exactly as
+   * update() would have played it out. Copy the engine first to finish it on
+   * another thread while the original keeps being displayed.
+   *
+   * @param onMinute Called after every simulated minute with the match clock.
+   * Returning false stops the simulation before the final whistle.
+   */
+  void simulateRemaining(const std::function<bool(float)>& onMinute = {});
+
+  /**
+   * @brief Captures the current state and every following tick into
+   * @p recorder, or stops recording if null. Copies of the engine keep
+   * writing to the same recorder.
+   */
+  void setRecorder(MatchReplayRecorder* recorder);
+
+  /**
+   * @brief Adds the position of every player to @p heatmaps after each tick,
+   * or stops if null; tracking can be switched on and off mid-match. The
+   * grids are not cleared, and copies of the engine keep writing to them.
+   */
+  void setHeatmaps(MatchHeatmaps* heatmaps);
+  MatchHeatmaps* getHeatmaps() const { return heatmaps; }
+
+  /** @brief Changes a team's strategy from the next tick on. */
+  void setStrategy(bool isHomeTeam, const Strategy& strategy);
+
+  bool isFinished() const { return matchTimeMinutes >= MATCH_LENGTH_MINUTES; }
+
+  uint64_t getSeed() const { return seed; }
+
+  // ========== Snapshots ==========
+
+  /** @brief Finds the Player object of an id, or returns null. */
+  using PlayerLookup = std::function<const Player*(PlayerID)>;
+
+  /** @brief Captures the whole match state, event history included. */
+  MatchEngineSnapshot snapshot() const;
+
+  /**
+   * @brief Returns the match to a previously captured state.
+   *
+   * Playing on from a restored snapshot produces exactly the same ticks as
+   * the original engine did. The replay recorder and heatmaps, if any, stay
+   * attached.
+   *
+   * @param findPlayer Resolves the snapshot's player ids. By default only the
+   * players currently in this engine are searched, which is enough unless a
+   * substitution happened since the snapshot was taken.
+   * @return false, leaving the engine untouched, if a player cannot be found.
+   */
+  bool restore(const MatchEngineSnapshot& state,
+               const PlayerLookup& findPlayer = {});
+
+  /**
+   * @brief Branches the match for a what-if continuation.
+   *
+   * Cheaper than a copy: the event history is not carried over, so the fork
+   * only allocates its player list and an empty event log, and it records
+   * neither a replay nor heatmaps. The statistics so far are kept.
+   *
+   * @param forkSeed If set, the fork's streams are reseeded so that several
+   * forks play out different continuations. Otherwise the fork continues
+   * exactly as this engine would.
+   */
+  MatchEngine fork(std::optional<uint64_t> forkSeed = std::nullopt) const;
+
   const std::vector<MatchPlayer>& getPlayers() const { return players; }
+  const MatchKinematics& getKinematics() const { return kinematics; }
   const MatchBall& getBall() const { return ball; }
-  const std::vector<MatchEvent>& getEvents() const { return events; }
+  const MatchFormation& getFormation() const { return formation; }
+
+  /** @brief Positions at the start of the latest tick. */
+  const MatchRenderState& getPreviousState() const { return previousState; }
+
+  /**
+   * @brief Fraction of the next tick already accumulated, in [0, 1). Render
+   * at lerp(previous, current, alpha) for motion that is smooth at any frame
+   * rate.
+   */
+  float getInterpolationAlpha() const { return accumulator / fixedStep; }
+
+  Vector2F interpolatedPlayerPosition(size_t index) const;
+  Vector2F interpolatedBallPosition() const;
+  /**
+   * @brief Every event since kickoff, in order, up to the latest
+   * MatchEventLog::CAPACITY.
+   */
+  std::span<const MatchEvent> getEvents() const { return events.view(); }
+
+  /** @brief Statistics since kickoff, complete once the match is finished. */
+  const MatchStats& getStats() const { return stats; }
+
+  /**
+   * @brief Phase timings and event counts since kickoff, all zero unless
+   * built with MATCH_PROFILING. Forks start from zero, and
+   * MatchEngineBatch does not time the steering it runs for the engine.
+   */
+  const MatchProfile& getProfile() const { return profile; }
 
   void substitutePlayer(uint32_t outPlayerId, const Player* inPlayer);
 
   int getHomeScore() const { return homeScore; }
   int getAwayScore() const { return awayScore; }
   float getMatchTimeMinutes() const { return matchTimeMinutes; }
+  uint32_t getTickCount() const { return tickCount; }
 
  private:
+  // Times the individual tick phases in benchmarks/match_benchmark.cpp
+  friend struct MatchEnginePhaseProbe;
+  // Runs the tick phases itself to integrate many matches at once
+  friend class MatchEngineBatch;
+
+  struct ForkTag
+  {
+  };
+
+  /** @brief Copies everything but the event history, recorder and heatmaps. */
+  MatchEngine(const MatchEngine& parent, ForkTag);
+
   std::vector<MatchPlayer> players;
+  MatchKinematics kinematics;
   MatchBall ball;
-  const StatsConfig& statsConfig;
+  MatchFormation formation;
+  // First slot of ball.possessedBy, or -1; a team playing itself shares its
+  // Player objects
+  int carrierSlot = -1;
+  const StatsConfig* statsConfig;
   Strategy homeStrategy;
   Strategy awayStrategy;
 
-  std::vector<MatchEvent> events;
+  MatchEventLog events;
+  MatchStats stats;
+  MatchProfile profile;
 
   float matchTimeMinutes = 0.0f;
+  uint32_t tickCount = 0;
+
+  // Fixed timestep
+  int tickRate = DEFAULT_TICK_RATE;
+  float fixedStep = 1.0f / DEFAULT_TICK_RATE;
+  float accumulator = 0.0f;
+  float ballRetentionPerTick = 0.0f;  // ball.friction rescaled to fixedStep
+  MatchRenderState previousState;
   int homeScore = 0;
   int awayScore = 0;
 
+  MatchReplayRecorder* recorder = nullptr;
+  MatchHeatmaps* heatmaps = nullptr;
+
+  // Minutes before an opponent can reach tackling range of the ball carrier,
+  // 0 if loose. The tackle checks are skipped until then.
+  float uncontestedMinutes = 0.0f;
+
+  // One random stream per subsystem, all derived from the match seed
+  enum class RngStream : uint64_t
+  {
+    DECISION,
+    TACKLE
+  };
+
+  uint64_t seed;
+  RandomStream decisionRng;
+  RandomStream tackleRng;
+
   // Constants
   const float PITCH_ASPECT_RATIO = 1.5f;  // Length / Width
   const float TIME_SCALE =
       60.0f;  // 1 real second = 60 simulation seconds (1 minute)
 
+  void seedStreams(uint64_t matchSeed);
   void initializePlayers(const Lineup& lineup, bool isHomeTeam);
+  void addPlayer(const MatchPlayer& mp, float maxSpeed, float acceleration);
 
-  void calculateForces(float dt);
+  /** @brief Refills the formation, after a lineup or strategy change. */
+  void buildFormation();
+  /** @brief Hands the ball to @p player, or frees it if null. */
+  void setCarrier(const Player* player);
+
+  size_t indexOf(const MatchPlayer& mp) const;
+  Vector2F positionOf(const MatchPlayer& mp) const;
+  Vector2F velocityOf(const MatchPlayer& mp) const;
+
+  // One fixed tick, made of the phases below in this order
+  void step(float dt);
+  void beginTick(float dt);
+  void calculateForces(float dt);  // steerPlayers(), then integration
+  void endTick(float dt);          // The three phases below, then recording
   void resolvePossessionAndPassing(float dt);
   void checkGoals();
+  void moveBall(float dt);
+
+  /**
+   * @brief Fills the kinematic steering inputs from the tactical logic.
+   * MatchEngineBatch evaluates the same logic across matches; change both.
+   */
+  void steerPlayers();
+
+  void captureState(MatchRenderState& state) const;
   void resetPositions(bool homeConceded);
 
-  void logEvent(const std::string& msg);
+  void addStatLine(size_t slot);
+  MatchStatLine& statLine(size_t slot);
+  bool isShotOnTarget(bool isHomeTeam) const;
+
+  void recordEvent(MatchEventType type, bool isHomeTeam,
+                   const Player* actor = nullptr,
+                   const Player* target = nullptr);
 };
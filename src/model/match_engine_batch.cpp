@@ -0,0 +1,285 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "match_engine_batch.h"
+
+#include <algorithm>
+#include <array>
+
+#include "model/simd_ops.h"
+
+/**
+ * @brief Where each slot of each lane heads, per possession state.
+ *
+ * The engines' MatchFormation tables interleaved by lane, loaded once per
+ * match; only the choice between them is made per tick.
+ */
+struct MatchEngineBatch::Tactics
+{
+  using Slots = MatchKinematicsBatch::Slots;
+  using Lanes = std::array<float, LANES>;
+
+  alignas(64) Slots player;  // First slot of the same Player, as a float
+  alignas(64) Slots side;    // 1 for the home team, -1 for the away team
+  alignas(64) Slots keeper;  // 1 for goalkeepers
+  alignas(64) Slots goalX;   // Goal the slot runs at with the ball
+  alignas(64) Slots keeperX;
+  alignas(64) Slots keeperSpeed;
+  alignas(64) Slots attackX;  // Target while the team has the ball
+  alignas(64) Slots attackY;
+  alignas(64) Slots spread;
+  alignas(64) Slots defendX;  // Target otherwise
+  alignas(64) Slots defendY;
+  alignas(64) Slots pressRadius;
+  alignas(64) Slots pressAggression;
+
+  // Updated every tick, -1 and 0 while the ball is loose
+  alignas(64) Lanes carrierSlot;
+  alignas(64) Lanes carrierSide;
+
+  void clear();
+  void load(size_t lane, const MatchEngine& engine);
+  void track(size_t lane, const MatchEngine& engine);
+
+  template <typename Ops>
+  void steer(MatchKinematicsBatch& k) const;
+};
+
+void MatchEngineBatch::Tactics::clear()
+{
+  for (Slots* slots :
+       {&player, &side, &keeper, &goalX, &keeperX, &keeperSpeed, &attackX, &attackY,
+        &spread, &defendX, &defendY, &pressRadius, &pressAggression})
+  {
+    for (auto& lanes : *slots) lanes.fill(0.0f);
+  }
+  carrierSlot.fill(-1.0f);
+  carrierSide.fill(0.0f);
+}
+
+void MatchEngineBatch::Tactics::load(size_t lane, const MatchEngine& engine)
+{
+  const MatchFormation& formation = engine.formation;
+  for (size_t i = 0; i < engine.players.size(); ++i)
+  {
+    const MatchPlayer& mp = engine.players[i];
+
+    // The carrier is found by Player, which a team playing itself shares
+    auto first = std::ranges::find_if(engine.players,
+                                      [&mp](const MatchPlayer& p)
+                                      { return p.player == mp.player; });
+    player[i][lane] = static_cast<float>(first - engine.players.begin());
+    side[i][lane] = mp.isHomeTeam ? 1.0f : -1.0f;
+    keeper[i][lane] = formation.keeper[i] ? 1.0f : 0.0f;
+    goalX[i][lane] = formation.goalX[i];
+    keeperX[i][lane] = formation.keeperX[i];
+    keeperSpeed[i][lane] = formation.keeperSpeed[i];
+    attackX[i][lane] = formation.attackX[i];
+    attackY[i][lane] = formation.attackY[i];
+    spread[i][lane] = formation.spread[i];
+    defendX[i][lane] = formation.defendX[i];
+    defendY[i][lane] = formation.defendY[i];
+    pressRadius[i][lane] = formation.pressRadius[i];
+    pressAggression[i][lane] = formation.pressAggression[i];
+  }
+}
+
+void MatchEngineBatch::Tactics::track(size_t lane, const MatchEngine& engine)
+{
+  carrierSlot[lane] = static_cast<float>(engine.carrierSlot);
+  carrierSide[lane] = 0.0f;
+  if (engine.carrierSlot < 0) return;
+
+  const bool home =
+      engine.players[static_cast<size_t>(engine.carrierSlot)].isHomeTeam;
+  carrierSide[lane] = home ? 1.0f : -1.0f;
+}
+
+// Every select below takes the branch MatchEngine::steerPlayers() would take
+// in that lane, and every value is computed with the same operations
+template <typename Ops>
+void MatchEngineBatch::Tactics::steer(MatchKinematicsBatch& k) const
+{
+  using V = typename Ops::V;
+  static_assert(Ops::WIDTH == LANES);
+
+  const V zero = Ops::set1(0.0f);
+  const V half = Ops::set1(0.5f);
+  const V bX = Ops::load(k.ballX.data());
+  const V bY = Ops::load(k.ballY.data());
+  const V carrier = Ops::load(carrierSlot.data());
+  const V attacking = Ops::load(carrierSide.data());
+
+  // Keepers follow the ball's y slightly
+  V follow = Ops::mul(Ops::sub(bY, half), Ops::set1(0.3f));
+  follow = Ops::select(Ops::lt(follow, Ops::set1(-0.15f)), Ops::set1(-0.15f),
+                       Ops::select(Ops::lt(Ops::set1(0.15f), follow),
+                                   Ops::set1(0.15f), follow));
+  const V keeperY = Ops::add(half, follow);
+
+  for (size_t i = 0; i < k.count; ++i)
+  {
+    const V px = Ops::load(k.x[i].data());
+    const V py = Ops::load(k.y[i].data());
+    const auto isCarrier = Ops::eq(carrier, Ops::load(player[i].data()));
+    const auto teamHasBall =
+        Ops::lt(zero, Ops::mul(Ops::load(side[i].data()), attacking));
+    const auto isKeeper = Ops::lt(zero, Ops::load(keeper[i].data()));
+    const auto upperHalf = Ops::lt(half, py);
+
+    // Carrier runs towards the opponent goal, drifting towards the center
+    V gx = Ops::sub(Ops::load(goalX[i].data()), px);
+    V gy = Ops::sub(half, py);
+    gy = Ops::add(gy, Ops::select(upperHalf, Ops::set1(-0.1f),
+                                  Ops::set1(0.1f)));
+    V len = Ops::sqrt(Ops::add(Ops::mul(gx, gx), Ops::mul(gy, gy)));
+    auto nonZero = Ops::lt(Ops::set1(0.0001f), len);
+    V steerX = Ops::select(nonZero, Ops::div(gx, len), zero);
+    V steerY = Ops::select(nonZero, Ops::div(gy, len), zero);
+
+    // Outfield players push and spread, or drop and squeeze
+    V spreadY = Ops::load(spread[i].data());
+    V targetX = Ops::select(teamHasBall, Ops::load(attackX[i].data()),
+                            Ops::load(defendX[i].data()));
+    V targetY = Ops::select(
+        teamHasBall,
+        Ops::add(Ops::load(attackY[i].data()),
+                 Ops::select(upperHalf, spreadY, Ops::sub(zero, spreadY))),
+        Ops::load(defendY[i].data()));
+
+    // Keepers hold their line unless the ball is loose or lost and close
+    V dx = Ops::sub(px, bX);
+    V dy = Ops::sub(py, bY);
+    V distToBall = Ops::sqrt(Ops::add(Ops::mul(dx, dx), Ops::mul(dy, dy)));
+    auto close = Ops::lt(distToBall, Ops::set1(MatchEngine::KEEPER_RUSH_RANGE));
+    V lineX = Ops::load(keeperX[i].data());
+    V normalSpeed = Ops::load(keeperSpeed[i].data());
+    V keeperTargetX =
+        Ops::select(teamHasBall, lineX, Ops::select(close, bX, lineX));
+    V keeperTargetY =
+        Ops::select(teamHasBall, keeperY, Ops::select(close, bY, keeperY));
+    V keeperTop = Ops::select(
+        teamHasBall, normalSpeed,
+        Ops::select(close, Ops::set1(MatchEngine::KEEPER_BURST_SPEED),
+                    normalSpeed));
+    targetX = Ops::select(isKeeper, keeperTargetX, targetX);
+    targetY = Ops::select(isKeeper, keeperTargetY, targetY);
+
+    // Outfield players press when the ball is loose or lost
+    V radius = Ops::select(
+        teamHasBall, zero,
+        Ops::select(isKeeper, zero, Ops::load(pressRadius[i].data())));
+    V aggression = Ops::select(
+        teamHasBall, zero,
+        Ops::select(isKeeper, zero, Ops::load(pressAggression[i].data())));
+
+    V top = Ops::load(k.maxSpeed[i].data());
+    Ops::store(k.steerX[i].data(), Ops::select(isCarrier, steerX, zero));
+    Ops::store(k.steerY[i].data(), Ops::select(isCarrier, steerY, zero));
+    Ops::store(k.pull[i].data(), Ops::select(isCarrier, zero, half));
+    Ops::store(k.targetX[i].data(), Ops::select(isCarrier, px, targetX));
+    Ops::store(k.targetY[i].data(), Ops::select(isCarrier, py, targetY));
+    Ops::store(k.pressRadius[i].data(), Ops::select(isCarrier, zero, radius));
+    Ops::store(k.pressAggression[i].data(),
+               Ops::select(isCarrier, zero, aggression));
+    Ops::store(k.maxSpeed[i].data(),
+               Ops::select(isCarrier, top,
+                           Ops::select(isKeeper, keeperTop, top)));
+  }
+}
+
+MatchEngineBatch::MatchEngineBatch()
+    : kinematics(std::make_unique<MatchKinematicsBatch>()),
+      tactics(std::make_unique<Tactics>())
+{
+}
+
+MatchEngineBatch::~MatchEngineBatch() = default;
+
+size_t MatchEngineBatch::add(const Lineup& home_lineup,
+                             const Lineup& away_lineup,
+                             const Strategy& home_strat,
+                             const Strategy& away_strat,
+                             const StatsConfig& config, uint64_t seed)
+{
+  engines.emplace_back(home_lineup, away_lineup, home_strat, away_strat,
+                       config, seed);
+  return engines.size() - 1;
+}
+
+void MatchEngineBatch::simulateToEnd(int ticksPerMinute)
+{
+  for (MatchEngine& engine : engines)
+  {
+    engine.seedStreams(engine.getSeed());
+    engine.setTickRate(ticksPerMinute);
+  }
+
+  // One group at a time keeps its state hot in the cache
+  for (size_t first = 0; first < engines.size(); first += LANES)
+  {
+    simulateGroup(first, std::min(LANES, engines.size() - first));
+  }
+}
+
+void MatchEngineBatch::simulateGroup(size_t first, size_t count)
+{
+  MatchEngine* group = engines.data() + first;
+
+  kinematics->clear();
+  tactics->clear();
+  for (size_t lane = 0; lane < count; ++lane)
+  {
+    kinematics->count =
+        std::max(kinematics->count, group[lane].kinematics.count);
+  }
+  for (size_t lane = 0; lane < count; ++lane)
+  {
+    kinematics->load(lane, group[lane].kinematics, group[lane].ball.position);
+    tactics->load(lane, group[lane]);
+  }
+
+  // The clock advances in beginTick(), so a match is finished during its own
+  // last tick; remember which lanes are playing instead
+  std::array<bool, LANES> playing{};
+  bool running = true;
+  while (running)
+  {
+    for (size_t lane = 0; lane < count; ++lane)
+    {
+      MatchEngine& engine = group[lane];
+      playing[lane] = !engine.isFinished();
+      if (!playing[lane]) continue;
+      engine.beginTick(engine.fixedStep);
+      tactics->track(lane, engine);
+      kinematics->ballX[lane] = engine.ball.position.x;
+      kinematics->ballY[lane] = engine.ball.position.y;
+    }
+
+    // Every lane shares the tick length, only finished lanes differ
+    tactics->steer<LaneOps>(*kinematics);
+    kinematics->integrate(group[0].fixedStep);
+
+    running = false;
+    for (size_t lane = 0; lane < count; ++lane)
+    {
+      if (!playing[lane]) continue;
+      MatchEngine& engine = group[lane];
+      kinematics->store(lane, engine.kinematics);
+
+      // A goal sends everyone back to the kickoff positions
+      const int goals = engine.getHomeScore() + engine.getAwayScore();
+      engine.endTick(engine.fixedStep);
+      if (engine.getHomeScore() + engine.getAwayScore() != goals)
+      {
+        kinematics->loadMotion(lane, engine.kinematics);
+      }
+      running = running || !engine.isFinished();
+    }
+  }
+}
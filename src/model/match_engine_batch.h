@@ -0,0 +1,70 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "model/match_engine.h"
+#include "model/match_kinematics.h"
+
+/**
+ * @class MatchEngineBatch
+ * @brief Plays many independent headless matches in lockstep.
+ *
+ * Matches are stepped in groups of LANES, one match per SIMD lane. The
+ * player state of a group lives interleaved in a MatchKinematicsBatch for the
+ * whole match: steering is evaluated for every lane at once from a table of
+ * each match's tactical targets, then the group is integrated together.
+ * Possession, passing, goals and kickoffs stay per match on its MatchEngine,
+ * which gets the integrated positions back every tick; a match that scores
+ * reloads its own lane. Each match ends exactly as MatchEngine::simulateToEnd()
+ * would have played it.
+ *
+ * The steering inputs of the engines' kinematics are not written back.
+ */
+class MatchEngineBatch
+{
+ public:
+  /** @brief Matches integrated together, the SIMD width in floats. */
+  static constexpr size_t LANES = MatchKinematicsBatch::LANES;
+
+  MatchEngineBatch();
+  ~MatchEngineBatch();
+
+  /**
+   * @brief Adds a match, set up as the MatchEngine constructor would.
+   * @param seed Seed of the match, as passed to simulateToEnd().
+   * @return The index of the match.
+   */
+  size_t add(const Lineup& home_lineup, const Lineup& away_lineup,
+             const Strategy& home_strat, const Strategy& away_strat,
+             const StatsConfig& config, uint64_t seed);
+
+  size_t size() const { return engines.size(); }
+
+  /** @brief The match at @p index, finished after simulateToEnd(). */
+  const MatchEngine& operator[](size_t index) const { return engines[index]; }
+
+  /**
+   * @brief Runs every match to the final whistle.
+   * @param ticksPerMinute Number of fixed ticks per simulated minute.
+   */
+  void simulateToEnd(int ticksPerMinute = MatchEngine::DEFAULT_TICK_RATE);
+
+ private:
+  struct Tactics;
+
+  std::vector<MatchEngine> engines;
+  std::unique_ptr<MatchKinematicsBatch> kinematics;
+  std::unique_ptr<Tactics> tactics;
+
+  void simulateGroup(size_t first, size_t count);
+};
@@ -0,0 +1,63 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "match_engine_pool.h"
+
+MatchEnginePool::Lease::Lease(MatchEnginePool& owner,
+                              std::unique_ptr<MatchEngine> leased)
+    : pool(&owner), engine(std::move(leased))
+{
+}
+
+MatchEnginePool::Lease::~Lease()
+{
+  if (engine) pool->release(std::move(engine));
+}
+
+MatchEnginePool::Lease MatchEnginePool::acquire(const Lineup& home_lineup,
+                                                const Lineup& away_lineup,
+                                                const Strategy& home_strat,
+                                                const Strategy& away_strat,
+                                                const StatsConfig& config,
+                                                uint64_t seed)
+{
+  std::unique_ptr<MatchEngine> engine;
+  {
+    std::scoped_lock lock(mutex);
+    if (!idle.empty())
+    {
+      engine = std::move(idle.back());
+      idle.pop_back();
+    }
+  }
+
+  // Set up outside the lock, it is most of the cost
+  if (engine)
+  {
+    engine->reset(home_lineup, away_lineup, home_strat, away_strat, config,
+                  seed);
+  }
+  else
+  {
+    engine = std::make_unique<MatchEngine>(home_lineup, away_lineup,
+                                           home_strat, away_strat, config, seed);
+  }
+  return {*this, std::move(engine)};
+}
+
+size_t MatchEnginePool::idleCount() const
+{
+  std::scoped_lock lock(mutex);
+  return idle.size();
+}
+
+void MatchEnginePool::release(std::unique_ptr<MatchEngine> engine)
+{
+  std::scoped_lock lock(mutex);
+  idle.push_back(std::move(engine));
+}
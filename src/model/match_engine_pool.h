@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "model/match_engine.h"
+
+/**
+ * @class MatchEnginePool
+ * @brief Keeps finished MatchEngines for the next fixtures, so a headless
+ * matchday does not construct and destroy an engine per match.
+ *
+ * acquire() resets an idle engine, and only builds a new one while every
+ * engine is on loan. Once the pool holds one engine per simulating thread,
+ * playing a match allocates nothing. Thread safe.
+ *
+ * Only PhysicsSimulator uses a pool, so engines are reused on matchdays
+ * played at a physics tier. The default statistical matchday builds no
+ * engine at all.
+ */
+class MatchEnginePool
+{
+ public:
+  /** @brief An engine on loan, handed back to its pool when destroyed. */
+  class Lease
+  {
+   public:
+    Lease(Lease&&) noexcept = default;
+    Lease& operator=(Lease&&) = delete;
+    ~Lease();
+
+    MatchEngine& operator*() const { return *engine; }
+    MatchEngine* operator->() const { return engine.get(); }
+
+   private:
+    friend class MatchEnginePool;
+    Lease(MatchEnginePool& owner, std::unique_ptr<MatchEngine> leased);
+
+    MatchEnginePool* pool;
+    std::unique_ptr<MatchEngine> engine;
+  };
+
+  MatchEnginePool() = default;
+  MatchEnginePool(const MatchEnginePool&) = delete;
+  MatchEnginePool& operator=(const MatchEnginePool&) = delete;
+
+  /** @brief An engine set up as MatchEngine's constructor would. */
+  Lease acquire(const Lineup& home_lineup, const Lineup& away_lineup,
+                const Strategy& home_strat, const Strategy& away_strat,
+                const StatsConfig& config,
+                uint64_t seed = MatchEngine::DEFAULT_SEED);
+
+  /** @brief Engines waiting for their next match. */
+  size_t idleCount() const;
+
+ private:
+  void release(std::unique_ptr<MatchEngine> engine);
+
+  mutable std::mutex mutex;
+  std::vector<std::unique_ptr<MatchEngine>> idle;  // Guarded by mutex
+};
@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "match_heatmap.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+void putVarint(std::vector<uint8_t>& out, uint32_t v)
+{
+  while (v >= 0x80)
+  {
+    out.push_back(static_cast<uint8_t>(v | 0x80));
+    v >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(v));
+}
+
+bool getVarint(std::span<const uint8_t> bytes, size_t& pos, uint32_t& v)
+{
+  v = 0;
+  for (int shift = 0; shift < 35 && pos < bytes.size(); shift += 7)
+  {
+    const uint8_t byte = bytes[pos++];
+    v |= static_cast<uint32_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return true;
+  }
+  return false;
+}
+}  // namespace
+
+size_t PlayerHeatmap::cellAt(float x, float y)
+{
+  const auto column = static_cast<size_t>(
+      std::clamp(x * COLUMNS, 0.0f, static_cast<float>(COLUMNS - 1)));
+  const auto row = static_cast<size_t>(
+      std::clamp(y * ROWS, 0.0f, static_cast<float>(ROWS - 1)));
+  return row * COLUMNS + column;
+}
+
+uint16_t PlayerHeatmap::peak() const
+{
+  return *std::max_element(cells.begin(), cells.end());
+}
+
+uint32_t PlayerHeatmap::total() const
+{
+  return std::accumulate(cells.begin(), cells.end(), uint32_t{0});
+}
+
+void MatchHeatmaps::clear() { lines.fill({}); }
+
+void MatchHeatmaps::accumulate(const MatchKinematics& kinematics,
+                               const MatchStats& stats, size_t slots)
+{
+  // Cells of all slots first, in a loop the compiler vectorizes
+  alignas(32) std::array<int32_t, MatchKinematics::CAPACITY> cells;
+  for (size_t i = 0; i < MatchKinematics::CAPACITY; ++i)
+  {
+    const float column =
+        std::clamp(kinematics.x[i] * PlayerHeatmap::COLUMNS, 0.0f,
+                   static_cast<float>(PlayerHeatmap::COLUMNS - 1));
+    const float row = std::clamp(kinematics.y[i] * PlayerHeatmap::ROWS, 0.0f,
+                                 static_cast<float>(PlayerHeatmap::ROWS - 1));
+    cells[i] = static_cast<int32_t>(row) * PlayerHeatmap::COLUMNS +
+               static_cast<int32_t>(column);
+  }
+  for (size_t i = 0; i < slots; ++i)
+  {
+    lines[stats.lineOfSlot[i]].add(static_cast<size_t>(cells[i]), 1);
+  }
+}
+
+void SeasonHeatmap::add(const PlayerHeatmap& match)
+{
+  for (size_t i = 0; i < cells.size(); ++i)
+  {
+    cells[i] += match.cells[i];
+  }
+  ++matches;
+}
+
+uint32_t SeasonHeatmap::peak() const
+{
+  return *std::max_element(cells.begin(), cells.end());
+}
+
+std::vector<uint8_t> SeasonHeatmap::encode() const
+{
+  std::vector<uint8_t> out;
+  putVarint(out, matches);
+  for (size_t i = 0; i < cells.size();)
+  {
+    if (cells[i] != 0)
+    {
+      putVarint(out, cells[i++]);
+      continue;
+    }
+    size_t run = 0;
+    while (i < cells.size() && cells[i] == 0)
+    {
+      ++run;
+      ++i;
+    }
+    out.push_back(0);
+    putVarint(out, static_cast<uint32_t>(run));
+  }
+  return out;
+}
+
+std::optional<SeasonHeatmap> SeasonHeatmap::decode(
+    std::span<const uint8_t> bytes)
+{
+  SeasonHeatmap heatmap;
+  size_t pos = 0;
+  uint32_t value = 0;
+  if (!getVarint(bytes, pos, value) || value > UINT16_MAX) return std::nullopt;
+  heatmap.matches = static_cast<uint16_t>(value);
+
+  size_t cell = 0;
+  while (cell < heatmap.cells.size())
+  {
+    if (!getVarint(bytes, pos, value)) return std::nullopt;
+    if (value != 0)
+    {
+      heatmap.cells[cell++] = value;
+      continue;
+    }
+    // Cells start zeroed, a run only skips ahead
+    if (!getVarint(bytes, pos, value) || value == 0 ||
+        value > heatmap.cells.size() - cell)
+    {
+      return std::nullopt;
+    }
+    cell += value;
+  }
+  if (pos != bytes.size()) return std::nullopt;
+  return heatmap;
+}
@@ -0,0 +1,87 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "model/match_engine.h"
+
+/**
+ * @struct PlayerHeatmap
+ * @brief Ticks a player spent in each cell of a coarse grid over the pitch.
+ * Columns run along the pitch length (x), rows across its width (y).
+ */
+struct PlayerHeatmap
+{
+  static constexpr size_t COLUMNS = 24;
+  static constexpr size_t ROWS = 16;
+  static constexpr size_t CELLS = COLUMNS * ROWS;
+
+  std::array<uint16_t, CELLS> cells{};
+
+  /** @brief Cell containing a pitch position, positions off the pitch clamped. */
+  static size_t cellAt(float x, float y);
+
+  /** @brief Adds @p ticks to a cell, saturating instead of wrapping. */
+  void add(size_t cell, uint16_t ticks)
+  {
+    const uint32_t sum = uint32_t{cells[cell]} + ticks;
+    cells[cell] = static_cast<uint16_t>(sum > UINT16_MAX ? UINT16_MAX : sum);
+  }
+
+  uint16_t peak() const;
+  uint32_t total() const;
+};
+
+/**
+ * @struct MatchHeatmaps
+ * @brief One PlayerHeatmap per line of MatchStats, filled by the engine every
+ * tick while attached with MatchEngine::setHeatmaps().
+ *
+ * Fixed size, so a block is allocated once and cleared between matches.
+ */
+struct MatchHeatmaps
+{
+  std::array<PlayerHeatmap, MatchStats::MAX_PLAYERS> lines{};
+
+  /** @brief Zeroes every grid for the next match. */
+  void clear();
+
+  /** @brief Adds the current position of every player slot. */
+  void accumulate(const MatchKinematics& kinematics, const MatchStats& stats,
+                  size_t slots);
+};
+
+/**
+ * @struct SeasonHeatmap
+ * @brief Heatmaps of a player's tracked matches summed over a season.
+ *
+ * encode() stores the cells as varints with runs of empty cells collapsed to
+ * a zero and the run length, so the mostly empty grid of a specialist takes
+ * a few hundred bytes instead of 1.5 KB.
+ */
+struct SeasonHeatmap
+{
+  std::array<uint32_t, PlayerHeatmap::CELLS> cells{};
+  uint16_t matches = 0;
+
+  void add(const PlayerHeatmap& match);
+
+  uint32_t peak() const;
+
+  std::vector<uint8_t> encode() const;
+
+  /** @brief Decodes encode() output, or returns nullopt if it is malformed. */
+  static std::optional<SeasonHeatmap> decode(std::span<const uint8_t> bytes);
+};
@@ -0,0 +1,431 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "match_kinematics.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "model/simd_ops.h"
+
+namespace
+{
+constexpr float REPULSION_RADIUS = 0.05f;
+constexpr float REPULSION_MIN_DISTANCE = 0.001f;
+constexpr float REPULSION_STRENGTH = 10.0f;
+constexpr float NORMALIZE_EPSILON = 0.0001f;
+
+#if defined(__AVX__) || defined(__SSE2__)
+// Vectorized over players i. The repulsion loop walks the other players j in
+// the same order as the scalar kernel, so each lane accumulates its force in
+// exactly the same sequence. Forces are stored first and integrated in a
+// second pass so that no block sees positions already moved this tick.
+template <typename Ops>
+void integrateSimd(MatchKinematics& k, Vector2F ball, float dt)
+{
+  using V = typename Ops::V;
+  constexpr size_t W = Ops::WIDTH;
+  static_assert(MatchKinematics::CAPACITY % W == 0);
+
+  const size_t n = k.count;
+  const size_t padded = (n + W - 1) / W * W;
+
+  const V zero = Ops::set1(0.0f);
+  const V one = Ops::set1(1.0f);
+  const V vdt = Ops::set1(dt);
+  const V ballX = Ops::set1(ball.x);
+  const V ballY = Ops::set1(ball.y);
+  const V eps = Ops::set1(NORMALIZE_EPSILON);
+  const V repRadius = Ops::set1(REPULSION_RADIUS);
+  const V repMin = Ops::set1(REPULSION_MIN_DISTANCE);
+  const V repStrength = Ops::set1(REPULSION_STRENGTH);
+
+  // Forces are computed from the positions at the start of the tick
+  alignas(32) std::array<float, MatchKinematics::CAPACITY> forceX;
+  alignas(32) std::array<float, MatchKinematics::CAPACITY> forceY;
+
+  for (size_t i = 0; i < padded; i += W)
+  {
+    V px = Ops::load(&k.x[i]);
+    V py = Ops::load(&k.y[i]);
+
+    // Steering force plus spring towards the tactical target
+    V pull = Ops::load(&k.pull[i]);
+    V fx = Ops::add(Ops::load(&k.steerX[i]),
+                    Ops::mul(Ops::sub(Ops::load(&k.targetX[i]), px), pull));
+    V fy = Ops::add(Ops::load(&k.steerY[i]),
+                    Ops::mul(Ops::sub(Ops::load(&k.targetY[i]), py), pull));
+
+    // Pressing
+    V bx = Ops::sub(ballX, px);
+    V by = Ops::sub(ballY, py);
+    V bd = Ops::sqrt(Ops::add(Ops::mul(bx, bx), Ops::mul(by, by)));
+    V press = Ops::lt(bd, Ops::load(&k.pressRadius[i]));
+    V bnz = Ops::lt(eps, bd);
+    V aggr = Ops::load(&k.pressAggression[i]);
+    V bnx = Ops::select(bnz, Ops::div(bx, bd), zero);
+    V bny = Ops::select(bnz, Ops::div(by, bd), zero);
+    fx = Ops::select(press, Ops::add(fx, Ops::mul(bnx, aggr)), fx);
+    fy = Ops::select(press, Ops::add(fy, Ops::mul(bny, aggr)), fy);
+
+    // Repulsion from other players
+    for (size_t j = 0; j < n; ++j)
+    {
+      V ox = Ops::sub(Ops::set1(k.x[j]), px);
+      V oy = Ops::sub(Ops::set1(k.y[j]), py);
+      V d = Ops::sqrt(Ops::add(Ops::mul(ox, ox), Ops::mul(oy, oy)));
+      V near = Ops::both(Ops::lt(d, repRadius), Ops::lt(repMin, d));
+      V push = Ops::sub(repRadius, d);
+      V rx = Ops::mul(Ops::mul(Ops::div(ox, d), push), repStrength);
+      V ry = Ops::mul(Ops::mul(Ops::div(oy, d), push), repStrength);
+      fx = Ops::select(near, Ops::sub(fx, rx), fx);
+      fy = Ops::select(near, Ops::sub(fy, ry), fy);
+    }
+
+    Ops::store(&forceX[i], fx);
+    Ops::store(&forceY[i], fy);
+  }
+
+  for (size_t i = 0; i < padded; i += W)
+  {
+    // Apply force to velocity
+    V acc = Ops::load(&k.accel[i]);
+    V vx = Ops::add(Ops::load(&k.vx[i]),
+                    Ops::mul(Ops::mul(Ops::load(&forceX[i]), acc), vdt));
+    V vy = Ops::add(Ops::load(&k.vy[i]),
+                    Ops::mul(Ops::mul(Ops::load(&forceY[i]), acc), vdt));
+
+    // Clamp velocity to max speed
+    V maxSpeed = Ops::load(&k.maxSpeed[i]);
+    V speed = Ops::sqrt(Ops::add(Ops::mul(vx, vx), Ops::mul(vy, vy)));
+    V over = Ops::lt(maxSpeed, speed);
+    vx = Ops::select(over, Ops::mul(Ops::div(vx, speed), maxSpeed), vx);
+    vy = Ops::select(over, Ops::mul(Ops::div(vy, speed), maxSpeed), vy);
+
+    // Update position and clamp it to the pitch
+    V px = Ops::add(Ops::load(&k.x[i]), Ops::mul(vx, vdt));
+    V py = Ops::add(Ops::load(&k.y[i]), Ops::mul(vy, vdt));
+    px = Ops::select(Ops::lt(px, zero), zero, px);
+    py = Ops::select(Ops::lt(py, zero), zero, py);
+    px = Ops::select(Ops::lt(one, px), one, px);
+    py = Ops::select(Ops::lt(one, py), one, py);
+
+    Ops::store(&k.vx[i], vx);
+    Ops::store(&k.vy[i], vy);
+    Ops::store(&k.x[i], px);
+    Ops::store(&k.y[i], py);
+  }
+
+  // The pitch clamp pulled the padding slots onto the pitch, park them again
+  for (size_t i = n; i < padded; ++i)
+  {
+    k.x[i] = MatchKinematics::PARKED_POSITION;
+    k.y[i] = MatchKinematics::PARKED_POSITION;
+  }
+}
+#endif
+}  // namespace
+
+size_t MatchKinematics::add(Vector2F position, float max_speed,
+                            float acceleration)
+{
+  if (count >= CAPACITY) return CAPACITY;
+
+  size_t i = count++;
+  setPosition(i, position);
+  setVelocity(i, {0.0f, 0.0f});
+  maxSpeed[i] = max_speed;
+  accel[i] = acceleration;
+  return i;
+}
+
+void MatchKinematics::clear()
+{
+  count = 0;
+  x.fill(PARKED_POSITION);
+  y.fill(PARKED_POSITION);
+  vx.fill(0.0f);
+  vy.fill(0.0f);
+  maxSpeed.fill(0.0f);
+  accel.fill(0.0f);
+  steerX.fill(0.0f);
+  steerY.fill(0.0f);
+  targetX.fill(PARKED_POSITION);
+  targetY.fill(PARKED_POSITION);
+  pull.fill(0.0f);
+  pressRadius.fill(0.0f);
+  pressAggression.fill(0.0f);
+}
+
+void MatchKinematics::integrate(Vector2F ball, float dt)
+{
+#if defined(__AVX__)
+  integrateSimd<AvxOps>(*this, ball, dt);
+#elif defined(__SSE2__)
+  integrateSimd<SseOps>(*this, ball, dt);
+#else
+  integrateScalar(ball, dt);
+#endif
+}
+
+const char* MatchKinematics::kernelName()
+{
+#if defined(__AVX__)
+  return "AVX";
+#elif defined(__SSE2__)
+  return "SSE";
+#else
+  return "scalar";
+#endif
+}
+
+void MatchKinematics::integrateScalar(Vector2F ball, float dt)
+{
+  // Forces are computed from the positions at the start of the tick
+  std::array<float, CAPACITY> fx{};
+  std::array<float, CAPACITY> fy{};
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    fx[i] = steerX[i] + (targetX[i] - x[i]) * pull[i];
+    fy[i] = steerY[i] + (targetY[i] - y[i]) * pull[i];
+
+    float bx = ball.x - x[i];
+    float by = ball.y - y[i];
+    if (float bd = std::sqrt(bx * bx + by * by); bd < pressRadius[i])
+    {
+      float bnx = bd > NORMALIZE_EPSILON ? bx / bd : 0.0f;
+      float bny = bd > NORMALIZE_EPSILON ? by / bd : 0.0f;
+      fx[i] = fx[i] + bnx * pressAggression[i];
+      fy[i] = fy[i] + bny * pressAggression[i];
+    }
+
+    for (size_t j = 0; j < count; ++j)
+    {
+      float ox = x[j] - x[i];
+      float oy = y[j] - y[i];
+      float d = std::sqrt(ox * ox + oy * oy);
+      if (d < REPULSION_RADIUS && d > REPULSION_MIN_DISTANCE)
+      {
+        fx[i] = fx[i] - (ox / d) * (REPULSION_RADIUS - d) * REPULSION_STRENGTH;
+        fy[i] = fy[i] - (oy / d) * (REPULSION_RADIUS - d) * REPULSION_STRENGTH;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    vx[i] = vx[i] + fx[i] * accel[i] * dt;
+    vy[i] = vy[i] + fy[i] * accel[i] * dt;
+
+    if (float speed = std::sqrt(vx[i] * vx[i] + vy[i] * vy[i]);
+        speed > maxSpeed[i])
+    {
+      vx[i] = (vx[i] / speed) * maxSpeed[i];
+      vy[i] = (vy[i] / speed) * maxSpeed[i];
+    }
+
+    x[i] = std::clamp(x[i] + vx[i] * dt, 0.0f, 1.0f);
+    y[i] = std::clamp(y[i] + vy[i] * dt, 0.0f, 1.0f);
+  }
+}
+
+void MatchKinematicsBatch::clear()
+{
+  count = 0;
+  for (Slots* slots : {&x, &y, &targetX, &targetY})
+  {
+    for (auto& lanes : *slots) lanes.fill(MatchKinematics::PARKED_POSITION);
+  }
+  for (Slots* slots : {&vx, &vy, &maxSpeed, &accel, &steerX, &steerY, &pull,
+                       &pressRadius, &pressAggression})
+  {
+    for (auto& lanes : *slots) lanes.fill(0.0f);
+  }
+  ballX.fill(0.5f);
+  ballY.fill(0.5f);
+}
+
+void MatchKinematicsBatch::load(size_t lane, const MatchKinematics& match,
+                                Vector2F ball)
+{
+  // Slots past the match's own count are parked, so they never interact
+  for (size_t i = 0; i < count; ++i)
+  {
+    x[i][lane] = match.x[i];
+    y[i][lane] = match.y[i];
+    vx[i][lane] = match.vx[i];
+    vy[i][lane] = match.vy[i];
+    maxSpeed[i][lane] = match.maxSpeed[i];
+    accel[i][lane] = match.accel[i];
+    steerX[i][lane] = match.steerX[i];
+    steerY[i][lane] = match.steerY[i];
+    targetX[i][lane] = match.targetX[i];
+    targetY[i][lane] = match.targetY[i];
+    pull[i][lane] = match.pull[i];
+    pressRadius[i][lane] = match.pressRadius[i];
+    pressAggression[i][lane] = match.pressAggression[i];
+  }
+  ballX[lane] = ball.x;
+  ballY[lane] = ball.y;
+}
+
+void MatchKinematicsBatch::loadMotion(size_t lane,
+                                      const MatchKinematics& match)
+{
+  for (size_t i = 0; i < match.count; ++i)
+  {
+    x[i][lane] = match.x[i];
+    y[i][lane] = match.y[i];
+    vx[i][lane] = match.vx[i];
+    vy[i][lane] = match.vy[i];
+  }
+}
+
+void MatchKinematicsBatch::store(size_t lane, MatchKinematics& match) const
+{
+  for (size_t i = 0; i < match.count; ++i)
+  {
+    match.x[i] = x[i][lane];
+    match.y[i] = y[i][lane];
+    match.vx[i] = vx[i][lane];
+    match.vy[i] = vy[i][lane];
+    match.maxSpeed[i] = maxSpeed[i][lane];
+  }
+}
+
+void MatchKinematicsBatch::integrate(float dt)
+{
+  integrateLanes<LaneOps>(dt);
+}
+
+template <typename Ops>
+void MatchKinematicsBatch::integrateLanes(float dt)
+{
+  using V = typename Ops::V;
+  static_assert(Ops::WIDTH == LANES);
+  const size_t n = count;
+
+  const V zero = Ops::set1(0.0f);
+  const V one = Ops::set1(1.0f);
+  const V vdt = Ops::set1(dt);
+  const V eps = Ops::set1(NORMALIZE_EPSILON);
+  const V repRadius = Ops::set1(REPULSION_RADIUS);
+  const V repMin = Ops::set1(REPULSION_MIN_DISTANCE);
+  const V repStrength = Ops::set1(REPULSION_STRENGTH);
+  // Squared distance beyond which no lane can be within the radius, with a
+  // margin for the rounding of the square root
+  const V farSquared = Ops::set1(REPULSION_RADIUS * REPULSION_RADIUS * 1.01f);
+  const V parked = Ops::set1(MatchKinematics::PARKED_POSITION);
+  const V bX = Ops::load(ballX.data());
+  const V bY = Ops::load(ballY.data());
+
+  // Forces are computed from the positions at the start of the tick
+  alignas(64) Slots forceX;
+  alignas(64) Slots forceY;
+  for (size_t i = 0; i < n; ++i)
+  {
+    V px = Ops::load(x[i].data());
+    V py = Ops::load(y[i].data());
+
+    // Steering force plus spring towards the tactical target
+    V pullI = Ops::load(pull[i].data());
+    V fx = Ops::add(Ops::load(steerX[i].data()),
+                    Ops::mul(Ops::sub(Ops::load(targetX[i].data()), px), pullI));
+    V fy = Ops::add(Ops::load(steerY[i].data()),
+                    Ops::mul(Ops::sub(Ops::load(targetY[i].data()), py), pullI));
+
+    // Pressing
+    V bx = Ops::sub(bX, px);
+    V by = Ops::sub(bY, py);
+    V bd = Ops::sqrt(Ops::add(Ops::mul(bx, bx), Ops::mul(by, by)));
+    auto press = Ops::lt(bd, Ops::load(pressRadius[i].data()));
+    auto bnz = Ops::lt(eps, bd);
+    V aggr = Ops::load(pressAggression[i].data());
+    V bnx = Ops::select(bnz, Ops::div(bx, bd), zero);
+    V bny = Ops::select(bnz, Ops::div(by, bd), zero);
+    Ops::store(forceX[i].data(),
+               Ops::select(press, Ops::add(fx, Ops::mul(bnx, aggr)), fx));
+    Ops::store(forceY[i].data(),
+               Ops::select(press, Ops::add(fy, Ops::mul(bny, aggr)), fy));
+  }
+
+  // Repulsion, each pair i < j evaluated once. Walking the pairs row by row
+  // applies the other slots to every slot in ascending order, as the scalar
+  // kernel does. The force on j from i is exactly minus the force on i from
+  // j: both offsets round symmetrically and equal positions give +0 either way
+  for (size_t i = 0; i < n; ++i)
+  {
+    const V px = Ops::load(x[i].data());
+    const V py = Ops::load(y[i].data());
+    V fx = Ops::load(forceX[i].data());
+    V fy = Ops::load(forceY[i].data());
+    for (size_t j = i + 1; j < n; ++j)
+    {
+      V ox = Ops::sub(Ops::load(x[j].data()), px);
+      V oy = Ops::sub(Ops::load(y[j].data()), py);
+      V squared = Ops::add(Ops::mul(ox, ox), Ops::mul(oy, oy));
+      // Most pairs are far apart in every lane, skip the divisions for them
+      if (!Ops::any(Ops::lt(squared, farSquared))) continue;
+
+      V d = Ops::sqrt(squared);
+      auto near = Ops::both(Ops::lt(d, repRadius), Ops::lt(repMin, d));
+      V push = Ops::sub(repRadius, d);
+      V rx = Ops::mul(Ops::mul(Ops::div(ox, d), push), repStrength);
+      V ry = Ops::mul(Ops::mul(Ops::div(oy, d), push), repStrength);
+      fx = Ops::select(near, Ops::sub(fx, rx), fx);
+      fy = Ops::select(near, Ops::sub(fy, ry), fy);
+
+      V fxJ = Ops::load(forceX[j].data());
+      V fyJ = Ops::load(forceY[j].data());
+      Ops::store(forceX[j].data(),
+                 Ops::select(near, Ops::sub(fxJ, Ops::sub(zero, rx)), fxJ));
+      Ops::store(forceY[j].data(),
+                 Ops::select(near, Ops::sub(fyJ, Ops::sub(zero, ry)), fyJ));
+    }
+    Ops::store(forceX[i].data(), fx);
+    Ops::store(forceY[i].data(), fy);
+  }
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    // Apply force to velocity
+    V acc = Ops::load(accel[i].data());
+    V velX = Ops::add(Ops::load(vx[i].data()),
+                      Ops::mul(Ops::mul(Ops::load(forceX[i].data()), acc), vdt));
+    V velY = Ops::add(Ops::load(vy[i].data()),
+                      Ops::mul(Ops::mul(Ops::load(forceY[i].data()), acc), vdt));
+
+    // Clamp velocity to max speed
+    V top = Ops::load(maxSpeed[i].data());
+    V speed = Ops::sqrt(Ops::add(Ops::mul(velX, velX), Ops::mul(velY, velY)));
+    auto over = Ops::lt(top, speed);
+    velX = Ops::select(over, Ops::mul(Ops::div(velX, speed), top), velX);
+    velY = Ops::select(over, Ops::mul(Ops::div(velY, speed), top), velY);
+
+    // Update position and clamp it to the pitch
+    const V oldX = Ops::load(x[i].data());
+    const V oldY = Ops::load(y[i].data());
+    V px = Ops::add(oldX, Ops::mul(velX, vdt));
+    V py = Ops::add(oldY, Ops::mul(velY, vdt));
+    px = Ops::select(Ops::lt(px, zero), zero, px);
+    py = Ops::select(Ops::lt(py, zero), zero, py);
+    px = Ops::select(Ops::lt(one, px), one, px);
+    py = Ops::select(Ops::lt(one, py), one, py);
+
+    // Slots a lane does not use stay parked instead of clamping onto the pitch
+    auto used = Ops::lt(oldX, parked);
+    px = Ops::select(used, px, oldX);
+    py = Ops::select(used, py, oldY);
+
+    Ops::store(vx[i].data(), velX);
+    Ops::store(vy[i].data(), velY);
+    Ops::store(x[i].data(), px);
+    Ops::store(y[i].data(), py);
+  }
+}
@@ -0,0 +1,174 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "global/types.h"
+
+/**
+ * @struct MatchKinematics
+ * @brief Structure-of-arrays kinematic state of every player in a match.
+ *
+ * Index i refers to the same player as MatchEngine::getPlayers()[i]. The
+ * arrays are padded to a multiple of the widest SIMD width, padding slots are
+ * parked far off the pitch so they never interact with real players.
+ *
+ * Each tick the engine fills the steering inputs (steer, target, pull, press)
+ * from its tactical logic and then calls integrate(), which applies tactical
+ * pull, pressing, player repulsion, velocity clamping and pitch clamping.
+ *
+ * The vectorized kernels perform the same floating point operations in the
+ * same order as integrateScalar(), so results are bit-identical. The source
+ * file is built with -ffp-contract=off to keep the compiler from fusing
+ * multiply-adds in only one of the two paths.
+ *
+ * Repulsion reads the positions of the previous tick for every player, so the
+ * order in which players are stored does not affect the result.
+ */
+struct MatchKinematics
+{
+  /** @brief Maximum number of players in a match (both teams, padded). */
+  static constexpr size_t CAPACITY = 32;
+
+  /** @brief Coordinate used to park padding slots out of repulsion range. */
+  static constexpr float PARKED_POSITION = 1.0e6f;
+
+  // State
+  alignas(32) std::array<float, CAPACITY> x{};
+  alignas(32) std::array<float, CAPACITY> y{};
+  alignas(32) std::array<float, CAPACITY> vx{};
+  alignas(32) std::array<float, CAPACITY> vy{};
+  alignas(32) std::array<float, CAPACITY> maxSpeed{};
+  alignas(32) std::array<float, CAPACITY> accel{};
+
+  // Per-tick steering inputs
+  alignas(32) std::array<float, CAPACITY> steerX{};  // Constant force
+  alignas(32) std::array<float, CAPACITY> steerY{};
+  alignas(32) std::array<float, CAPACITY> targetX{};  // Tactical target
+  alignas(32) std::array<float, CAPACITY> targetY{};
+  alignas(32) std::array<float, CAPACITY> pull{};  // Spring towards target
+  alignas(32) std::array<float, CAPACITY> pressRadius{};  // 0 = no pressing
+  alignas(32) std::array<float, CAPACITY> pressAggression{};
+
+  size_t count = 0;
+
+  MatchKinematics() { clear(); }
+
+  /**
+   * @brief Appends a player at rest.
+   * @return The index of the new player, or CAPACITY if the arrays are full.
+   */
+  size_t add(Vector2F position, float max_speed, float acceleration);
+
+  /** @brief Removes every player and parks all slots. */
+  void clear();
+
+  Vector2F position(size_t i) const { return {x[i], y[i]}; }
+  Vector2F velocity(size_t i) const { return {vx[i], vy[i]}; }
+  void setPosition(size_t i, Vector2F p)
+  {
+    x[i] = p.x;
+    y[i] = p.y;
+  }
+  void setVelocity(size_t i, Vector2F v)
+  {
+    vx[i] = v.x;
+    vy[i] = v.y;
+  }
+
+  /**
+   * @brief Integrates one tick using the widest kernel available.
+   * @param ball Current ball position, used for pressing.
+   * @param dt Step size.
+   */
+  void integrate(Vector2F ball, float dt);
+
+  /** @brief Portable reference implementation of integrate(). */
+  void integrateScalar(Vector2F ball, float dt);
+
+  /** @brief Name of the kernel used by integrate() ("AVX", "SSE", "scalar"). */
+  static const char* kernelName();
+};
+
+/**
+ * @struct MatchKinematicsBatch
+ * @brief Kinematic state of up to LANES matches, interleaved so that one SIMD
+ * register holds the same player slot of every match.
+ *
+ * Vectorizing across matches instead of across players makes every lane work
+ * on the same pair of slots, so each repulsion pair is evaluated once and
+ * applied to both players, halving the square roots and divisions of a tick.
+ * Negating a pair's force is exact, and every lane performs the operations of
+ * MatchKinematics::integrateScalar() in the same order, so a lane ends up
+ * bit-identical to integrating its match on its own.
+ *
+ * Lanes never interact. A lane without a match still computes, harmlessly,
+ * and parked slots stay parked.
+ */
+struct MatchKinematicsBatch
+{
+#if defined(__AVX512F__)
+  static constexpr size_t LANES = 16;
+#elif defined(__AVX__)
+  static constexpr size_t LANES = 8;
+#elif defined(__SSE2__)
+  static constexpr size_t LANES = 4;
+#else
+  static constexpr size_t LANES = 1;
+#endif
+
+  /** @brief One value per lane for each player slot. */
+  using Slots =
+      std::array<std::array<float, LANES>, MatchKinematics::CAPACITY>;
+
+  alignas(64) Slots x;
+  alignas(64) Slots y;
+  alignas(64) Slots vx;
+  alignas(64) Slots vy;
+  alignas(64) Slots maxSpeed;
+  alignas(64) Slots accel;
+  alignas(64) Slots steerX;
+  alignas(64) Slots steerY;
+  alignas(64) Slots targetX;
+  alignas(64) Slots targetY;
+  alignas(64) Slots pull;
+  alignas(64) Slots pressRadius;
+  alignas(64) Slots pressAggression;
+  alignas(64) std::array<float, LANES> ballX{};
+  alignas(64) std::array<float, LANES> ballY{};
+
+  /** @brief Slots integrated in every lane, the largest count of a lane. */
+  size_t count = 0;
+
+  MatchKinematicsBatch() { clear(); }
+
+  /** @brief Parks every slot of every lane. */
+  void clear();
+
+  /** @brief Copies slots [0, count) of a match and its ball into @p lane. */
+  void load(size_t lane, const MatchKinematics& match, Vector2F ball);
+
+  /** @brief Copies the positions and velocities of a match into @p lane. */
+  void loadMotion(size_t lane, const MatchKinematics& match);
+
+  /**
+   * @brief Copies the integrated positions and velocities of @p lane back,
+   * with the speed limits set by the steering.
+   */
+  void store(size_t lane, MatchKinematics& match) const;
+
+  /** @brief Integrates one tick of every lane. */
+  void integrate(float dt);
+
+ private:
+  template <typename Ops>
+  void integrateLanes(float dt);
+};
@@ -0,0 +1,234 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "match_predictor.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "model/match_engine.h"
+
+struct MatchPredictor::Job
+{
+  struct Chunk
+  {
+    int done = 0;  // Runs merged into tally, from the chunk's first run
+    bool queued = false;
+  };
+
+  Job(const Lineup& home_lineup, const Lineup& away_lineup,
+      const Strategy& home_strat, const Strategy& away_strat,
+      const StatsConfig& stats_config)
+      : homeLineup(home_lineup),
+        awayLineup(away_lineup),
+        homeStrategy(home_strat),
+        awayStrategy(away_strat),
+        config(stats_config)
+  {
+  }
+
+  bool hasInputs(const Lineup& home_lineup, const Lineup& away_lineup,
+                 const Strategy& home_strat, const Strategy& away_strat,
+                 const StatsConfig& stats_config) const
+  {
+    return &config == &stats_config && homeLineup == home_lineup &&
+           awayLineup == away_lineup && homeStrategy == home_strat &&
+           awayStrategy == away_strat;
+  }
+
+  const Lineup homeLineup;
+  const Lineup awayLineup;
+  const Strategy homeStrategy;
+  const Strategy awayStrategy;
+  const StatsConfig& config;
+  std::atomic<bool> active{false};  // Current job, read by its tasks
+
+  // Guarded by the predictor's mutex
+  Tally tally;
+  int requested = 0;
+  std::vector<Chunk> chunks;
+};
+
+void MatchPredictor::Tally::add(int home, int away)
+{
+  ++runs;
+  if (home > away) ++homeWins;
+  if (home == away) ++draws;
+  homeGoalsTotal += home;
+  awayGoalsTotal += away;
+  ++homeGoals[std::min(home, MatchPrediction::MAX_GOALS)];
+  ++awayGoals[std::min(away, MatchPrediction::MAX_GOALS)];
+}
+
+void MatchPredictor::Tally::merge(const Tally& other)
+{
+  runs += other.runs;
+  homeWins += other.homeWins;
+  draws += other.draws;
+  homeGoalsTotal += other.homeGoalsTotal;
+  awayGoalsTotal += other.awayGoalsTotal;
+  for (size_t k = 0; k < homeGoals.size(); ++k)
+  {
+    homeGoals[k] += other.homeGoals[k];
+    awayGoals[k] += other.awayGoals[k];
+  }
+}
+
+MatchPredictor::MatchPredictor(ThreadPool& thread_pool) : pool(thread_pool) {}
+
+MatchPredictor::~MatchPredictor() { cancel(); }
+
+void MatchPredictor::predict(const Lineup& home_lineup,
+                             const Lineup& away_lineup,
+                             const Strategy& home_strat,
+                             const Strategy& away_strat,
+                             const StatsConfig& config, int runs)
+{
+  std::shared_ptr<Job> job;
+  std::vector<Batch> batches;
+  {
+    std::scoped_lock lock(mutex);
+    auto it = std::ranges::find_if(
+        jobs,
+        [&](const std::shared_ptr<Job>& cached)
+        {
+          return cached->hasInputs(home_lineup, away_lineup, home_strat,
+                                   away_strat, config);
+        });
+    if (it != jobs.end())
+    {
+      job = *it;
+      jobs.erase(it);
+    }
+    else
+    {
+      job = std::make_shared<Job>(home_lineup, away_lineup, home_strat,
+                                  away_strat, config);
+    }
+    jobs.insert(jobs.begin(), job);
+    if (jobs.size() > CACHED_INPUTS) jobs.pop_back();
+
+    // Tasks of the old inputs stop at their next run, nobody waits for them
+    if (current && current != job) current->active = false;
+    current = job;
+    job->active = true;
+    job->requested = std::max(job->requested, std::max(runs, 0));
+    batches = queueMissing(*job);
+  }
+  submit(job, std::move(batches));
+}
+
+std::vector<MatchPredictor::Batch> MatchPredictor::queueMissing(Job& job)
+{
+  std::vector<Batch> batches;
+  const auto chunks =
+      static_cast<size_t>((job.requested + CHUNK_RUNS - 1) / CHUNK_RUNS);
+  if (job.chunks.size() < chunks) job.chunks.resize(chunks);
+
+  for (size_t c = 0; c < chunks; ++c)
+  {
+    Job::Chunk& chunk = job.chunks[c];
+    const int first = static_cast<int>(c) * CHUNK_RUNS;
+    const int size = std::min(CHUNK_RUNS, job.requested - first);
+    if (chunk.queued || chunk.done >= size) continue;
+
+    chunk.queued = true;
+    batches.push_back({c, first + chunk.done, size - chunk.done});
+  }
+  inFlight += static_cast<int>(batches.size());
+  return batches;
+}
+
+void MatchPredictor::submit(const std::shared_ptr<Job>& job,
+                            std::vector<Batch> batches)
+{
+  for (const Batch& batch : batches)
+  {
+    pool.submit([this, job, batch]() { runBatch(job, batch); });
+  }
+}
+
+void MatchPredictor::cancel()
+{
+  std::unique_lock lock(mutex);
+  for (const auto& job : jobs) job->active = false;
+  jobs.clear();
+  current.reset();
+  idle.wait(lock, [this]() { return inFlight == 0; });
+}
+
+MatchPrediction MatchPredictor::getPrediction() const
+{
+  std::scoped_lock lock(mutex);
+
+  MatchPrediction prediction;
+  if (!current) return prediction;
+
+  const Tally& tally = current->tally;
+  prediction.requestedRuns = current->requested;
+  prediction.completedRuns = tally.runs;
+  if (tally.runs == 0) return prediction;
+
+  const auto runs = static_cast<float>(tally.runs);
+  const int awayWins = tally.runs - tally.homeWins - tally.draws;
+  prediction.homeWin = static_cast<float>(tally.homeWins) / runs;
+  prediction.draw = static_cast<float>(tally.draws) / runs;
+  prediction.awayWin = static_cast<float>(awayWins) / runs;
+  prediction.expectedHomeGoals =
+      static_cast<float>(tally.homeGoalsTotal) / runs;
+  prediction.expectedAwayGoals =
+      static_cast<float>(tally.awayGoalsTotal) / runs;
+  for (size_t k = 0; k < prediction.homeGoals.size(); ++k)
+  {
+    prediction.homeGoals[k] = static_cast<float>(tally.homeGoals[k]) / runs;
+    prediction.awayGoals[k] = static_cast<float>(tally.awayGoals[k]) / runs;
+  }
+  return prediction;
+}
+
+bool MatchPredictor::isRunning() const
+{
+  std::scoped_lock lock(mutex);
+  return current && current->tally.runs < current->requested;
+}
+
+void MatchPredictor::runBatch(const std::shared_ptr<Job>& job,
+                              const Batch& batch)
+{
+  Tally local;
+  // One engine for the whole batch, reset for every run
+  MatchEngine engine(job->homeLineup, job->awayLineup, job->homeStrategy,
+                     job->awayStrategy, job->config,
+                     static_cast<uint64_t>(batch.first));
+  for (int run = batch.first; run < batch.first + batch.count; ++run)
+  {
+    if (!job->active) break;  // Superseded or cancelled
+
+    if (run != batch.first)
+    {
+      engine.reset(job->homeLineup, job->awayLineup, job->homeStrategy,
+                   job->awayStrategy, job->config, static_cast<uint64_t>(run));
+    }
+    engine.simulateToEnd(static_cast<uint64_t>(run));
+    local.add(engine.getHomeScore(), engine.getAwayScore());
+  }
+
+  // Nothing may touch the predictor after inFlight is decremented: cancel()
+  // may destroy it as soon as it sees zero, so this all runs under the lock
+  std::scoped_lock lock(mutex);
+  // The finished runs are a prefix of the batch, so they stay valid for
+  // these inputs even when the batch stopped early
+  job->tally.merge(local);
+  Job::Chunk& chunk = job->chunks[batch.chunk];
+  chunk.done += local.runs;
+  chunk.queued = false;
+  // Stopped, but the inputs became current again in the meantime. The pool
+  // only queues the tasks, so submitting under the lock cannot deadlock.
+  if (job == current) submit(job, queueMissing(*job));
+  if (--inFlight == 0) idle.notify_all();
+}
@@ -0,0 +1,163 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "global/stats_config.h"
+#include "global/thread_pool.h"
+#include "model/lineup.h"
+#include "model/strategy.h"
+
+/**
+ * @struct MatchPrediction
+ * @brief Aggregated outcome of the Monte Carlo runs finished so far.
+ */
+struct MatchPrediction
+{
+  /** @brief Goal counts at or above this value share the last bucket. */
+  static constexpr int MAX_GOALS = 6;
+
+  int completedRuns = 0;
+  int requestedRuns = 0;
+
+  float homeWin = 0.0f;
+  float draw = 0.0f;
+  float awayWin = 0.0f;
+
+  float expectedHomeGoals = 0.0f;
+  float expectedAwayGoals = 0.0f;
+
+  /** @brief Probability of scoring exactly k goals (k >= MAX_GOALS last). */
+  std::array<float, MAX_GOALS + 1> homeGoals{};
+  std::array<float, MAX_GOALS + 1> awayGoals{};
+
+  bool isComplete() const
+  {
+    return requestedRuns > 0 && completedRuns >= requestedRuns;
+  }
+
+  /** @brief Same prediction seen from the away team's side. */
+  MatchPrediction flipped() const
+  {
+    MatchPrediction result = *this;
+    std::swap(result.homeWin, result.awayWin);
+    std::swap(result.expectedHomeGoals, result.expectedAwayGoals);
+    std::swap(result.homeGoals, result.awayGoals);
+    return result;
+  }
+};
+
+/**
+ * @class MatchPredictor
+ * @brief Estimates a fixture's outcome from many seeded headless MatchEngine
+ * runs executed in the background.
+ *
+ * predict() returns immediately. Runs are split into chunks on the thread
+ * pool and merged as they finish, so getPrediction() sharpens progressively
+ * and a UI can show a usable estimate long before all runs are done.
+ *
+ * Run i always uses seed i, so two predictions that differ only in tactics
+ * are compared on the same random scenarios and their difference reflects
+ * the tactics rather than sampling noise.
+ *
+ * A new predict() call supersedes the previous one without waiting for it:
+ * its chunks stop after the run they are in. The runs finished for a set of
+ * inputs are kept for the last CACHED_INPUTS sets, so moving a slider back,
+ * or asking for more runs, only simulates the runs still missing.
+ *
+ * Lineups and strategies are copied, but the Player objects they point to
+ * are read while a prediction runs, so call cancel() before mutating players
+ * (e.g. training when the day advances); it also forgets the kept runs.
+ */
+class MatchPredictor
+{
+ public:
+  static constexpr int DEFAULT_RUNS = 1000;
+
+  /** @brief Runs per pool task, small enough to cancel quickly. */
+  static constexpr int CHUNK_RUNS = 20;
+
+  /** @brief Sets of inputs whose finished runs are kept. */
+  static constexpr size_t CACHED_INPUTS = 8;
+
+  explicit MatchPredictor(ThreadPool& pool = ThreadPool::shared());
+
+  /** @brief Cancels and waits for any running prediction. */
+  ~MatchPredictor();
+
+  MatchPredictor(const MatchPredictor&) = delete;
+  MatchPredictor& operator=(const MatchPredictor&) = delete;
+
+  /**
+   * @brief Starts predicting a fixture, replacing any running prediction.
+   * Never waits for pool work, so it can be called on every UI change.
+   * @param config Must outlive the prediction.
+   * @param runs Number of simulated matches.
+   */
+  void predict(const Lineup& home_lineup, const Lineup& away_lineup,
+               const Strategy& home_strat, const Strategy& away_strat,
+               const StatsConfig& config, int runs = DEFAULT_RUNS);
+
+  /**
+   * @brief Stops the running prediction, forgets the kept runs and waits for
+   * every task to exit.
+   */
+  void cancel();
+
+  /** @brief Snapshot of the current estimate. */
+  MatchPrediction getPrediction() const;
+
+  /** @brief True while runs of the latest prediction are still pending. */
+  bool isRunning() const;
+
+ private:
+  struct Job;
+
+  struct Tally
+  {
+    int runs = 0;
+    int homeWins = 0;
+    int draws = 0;
+    int homeGoalsTotal = 0;
+    int awayGoalsTotal = 0;
+    std::array<int, MatchPrediction::MAX_GOALS + 1> homeGoals{};
+    std::array<int, MatchPrediction::MAX_GOALS + 1> awayGoals{};
+
+    void add(int home, int away);
+    void merge(const Tally& other);
+  };
+
+  /** @brief Runs of one chunk to simulate, as queued. */
+  struct Batch
+  {
+    size_t chunk;
+    int first;
+    int count;
+  };
+
+  ThreadPool& pool;
+
+  mutable std::mutex mutex;
+  std::condition_variable idle;
+  std::shared_ptr<Job> current;            // Guarded by mutex
+  std::vector<std::shared_ptr<Job>> jobs;  // Guarded by mutex, newest first
+  int inFlight = 0;  // Guarded by mutex, tasks of any job
+
+  /** @brief Marks the missing runs of @p job as queued. Needs the mutex. */
+  std::vector<Batch> queueMissing(Job& job);
+  void submit(const std::shared_ptr<Job>& job, std::vector<Batch> batches);
+  void runBatch(const std::shared_ptr<Job>& job, const Batch& batch);
+};
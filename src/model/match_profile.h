@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(MATCH_PROFILING)
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#endif
+
+/**
+ * @struct MatchProfile
+ * @brief Where a MatchEngine spends its ticks: cycles per tick phase and
+ * counts of the events that make phases expensive.
+ *
+ * Only filled in builds configured with MATCH_PROFILING. Otherwise every
+ * counter stays zero and the calls that fill them compile to nothing.
+ * Cycles are time stamp counter ticks on x86 and nanoseconds elsewhere.
+ */
+struct MatchProfile
+{
+#if defined(MATCH_PROFILING)
+  static constexpr bool ENABLED = true;
+#else
+  static constexpr bool ENABLED = false;
+#endif
+
+  enum Phase : uint8_t
+  {
+    FORCES,      /*!< Steering and integration of every player */
+    POSSESSION,  /*!< Control, shots, passes and tackles */
+    GOALS,       /*!< Goal checks, kickoff resets included */
+    PHASE_COUNT
+  };
+
+  enum Event : uint8_t
+  {
+    POSSESSION_CHANGE, /*!< The ball reached a new player */
+    PASS,
+    TACKLE,            /*!< Tackles won */
+    GOAL_RESET,        /*!< Players sent back for a kickoff after a goal */
+    EVENT_COUNT
+  };
+
+  std::array<uint64_t, PHASE_COUNT> cycles{};
+  std::array<uint32_t, EVENT_COUNT> events{};
+  uint32_t ticks = 0; /*!< Ticks profiled */
+
+  /** @brief Current cycle count, 0 when profiling is compiled out. */
+  static uint64_t now()
+  {
+#if defined(MATCH_PROFILING)
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+#else
+    return 0;
+#endif
+  }
+
+  /** @brief Adds the cycles since @p start, taken from now(), to a phase. */
+  void addCycles(Phase phase, uint64_t start)
+  {
+    if constexpr (ENABLED) cycles[phase] += now() - start;
+  }
+
+  void count(Event event)
+  {
+    if constexpr (ENABLED) ++events[event];
+  }
+
+  void countTick()
+  {
+    if constexpr (ENABLED) ++ticks;
+  }
+
+  /** @brief Average cycles of a phase per profiled tick. */
+  double cyclesPerTick(Phase phase) const
+  {
+    return ticks > 0 ? static_cast<double>(cycles[phase]) / ticks : 0.0;
+  }
+};
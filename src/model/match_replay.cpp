@@ -0,0 +1,301 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "match_replay.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "model/match_engine.h"
+
+namespace
+{
+constexpr std::array<uint8_t, 4> MAGIC = {'F', 'M', 'R', 'P'};
+constexpr uint16_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 4 + 4 * 2 + 2 * 4;
+
+constexpr float POSITION_SCALE = 65535.0f;
+constexpr float TIME_SCALE = 100.0f;  // Hundredths of a minute
+
+// Per slot x and y, then ball x and y, clock, home and away score
+constexpr size_t EXTRA_CHANNELS = 5;
+
+constexpr size_t channelCount(size_t slots)
+{
+  return slots * 2 + EXTRA_CHANNELS;
+}
+
+uint16_t quantizePosition(float v)
+{
+  return static_cast<uint16_t>(
+      std::lround(std::clamp(v, 0.0f, 1.0f) * POSITION_SCALE));
+}
+
+float dequantizePosition(uint16_t q)
+{
+  return static_cast<float>(q) / POSITION_SCALE;
+}
+
+void putU16(std::vector<uint8_t>& out, uint16_t v)
+{
+  out.push_back(static_cast<uint8_t>(v));
+  out.push_back(static_cast<uint8_t>(v >> 8));
+}
+
+void putU32(std::vector<uint8_t>& out, uint32_t v)
+{
+  putU16(out, static_cast<uint16_t>(v));
+  putU16(out, static_cast<uint16_t>(v >> 16));
+}
+
+// Zigzag maps small negative deltas to small unsigned values
+void putDelta(std::vector<uint8_t>& out, int32_t delta)
+{
+  auto v = (static_cast<uint32_t>(delta) << 1) ^
+           static_cast<uint32_t>(delta >> 31);
+  while (v >= 0x80)
+  {
+    out.push_back(static_cast<uint8_t>(v | 0x80));
+    v >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(v));
+}
+
+/** @brief Bounds-checked little endian reader over the replay buffer. */
+struct Reader
+{
+  const std::vector<uint8_t>& data;
+  size_t pos;
+  bool ok = true;
+
+  uint16_t u16()
+  {
+    if (pos + 2 > data.size())
+    {
+      ok = false;
+      return 0;
+    }
+    auto v = static_cast<uint16_t>(data[pos] | (data[pos + 1] << 8));
+    pos += 2;
+    return v;
+  }
+
+  uint32_t u32()
+  {
+    uint32_t low = u16();
+    uint32_t high = u16();
+    return low | (high << 16);
+  }
+
+  int32_t delta()
+  {
+    uint32_t v = 0;
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+      if (pos >= data.size())
+      {
+        ok = false;
+        return 0;
+      }
+      uint8_t byte = data[pos++];
+      v |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80))
+      {
+        return static_cast<int32_t>(v >> 1) ^ -static_cast<int32_t>(v & 1);
+      }
+    }
+    ok = false;
+    return 0;
+  }
+};
+}  // namespace
+
+void MatchReplayRecorder::capture(const MatchEngine& engine)
+{
+  const auto& players = engine.getPlayers();
+  if (frameCount == 0)
+  {
+    tickRate = static_cast<uint16_t>(engine.getTickRate());
+    homeSlots.clear();
+    for (const MatchPlayer& mp : players) homeSlots.push_back(mp.isHomeTeam);
+    previous.assign(channelCount(homeSlots.size()), 0);
+  }
+
+  const MatchKinematics& kinematics = engine.getKinematics();
+  const size_t slots = homeSlots.size();
+  std::vector<uint16_t> channels(previous.size());
+  for (size_t i = 0; i < slots; ++i)
+  {
+    channels[i * 2] = quantizePosition(kinematics.x[i]);
+    channels[i * 2 + 1] = quantizePosition(kinematics.y[i]);
+  }
+  channels[slots * 2] = quantizePosition(engine.getBall().position.x);
+  channels[slots * 2 + 1] = quantizePosition(engine.getBall().position.y);
+  channels[slots * 2 + 2] = static_cast<uint16_t>(
+      std::lround(engine.getMatchTimeMinutes() * TIME_SCALE));
+  channels[slots * 2 + 3] = static_cast<uint16_t>(engine.getHomeScore());
+  channels[slots * 2 + 4] = static_cast<uint16_t>(engine.getAwayScore());
+
+  if (frameCount % KEYFRAME_INTERVAL == 0)
+  {
+    keyframes.push_back(static_cast<uint32_t>(frames.size()));
+    for (uint16_t c : channels) putU16(frames, c);
+  }
+  else
+  {
+    for (size_t c = 0; c < channels.size(); ++c)
+    {
+      putDelta(frames, static_cast<int32_t>(channels[c]) - previous[c]);
+    }
+  }
+
+  previous = std::move(channels);
+  ++frameCount;
+}
+
+std::vector<uint8_t> MatchReplayRecorder::toBytes() const
+{
+  std::vector<uint8_t> out;
+  out.reserve(HEADER_SIZE + homeSlots.size() + keyframes.size() * 4 +
+              frames.size());
+  for (uint8_t byte : MAGIC) out.push_back(byte);
+  putU16(out, VERSION);
+  putU16(out, tickRate);
+  putU16(out, static_cast<uint16_t>(KEYFRAME_INTERVAL));
+  putU16(out, static_cast<uint16_t>(homeSlots.size()));
+  putU32(out, frameCount);
+  putU32(out, static_cast<uint32_t>(keyframes.size()));
+  out.insert(out.end(), homeSlots.begin(), homeSlots.end());
+  for (uint32_t offset : keyframes) putU32(out, offset);
+  out.insert(out.end(), frames.begin(), frames.end());
+  return out;
+}
+
+bool MatchReplayRecorder::save(const std::string& path) const
+{
+  std::filesystem::path file(path);
+  if (file.has_parent_path())
+  {
+    std::error_code ec;
+    std::filesystem::create_directories(file.parent_path(), ec);
+  }
+
+  std::ofstream out(file, std::ios::binary);
+  if (!out) return false;
+
+  const std::vector<uint8_t> bytes = toBytes();
+  out.write(reinterpret_cast<const char*>(bytes.data()),
+            static_cast<std::streamsize>(bytes.size()));
+  return static_cast<bool>(out);
+}
+
+std::optional<MatchReplay> MatchReplay::fromBytes(std::vector<uint8_t> bytes)
+{
+  if (bytes.size() < HEADER_SIZE ||
+      !std::equal(MAGIC.begin(), MAGIC.end(), bytes.begin()))
+  {
+    return std::nullopt;
+  }
+
+  MatchReplay replay;
+  replay.data = std::move(bytes);
+  Reader reader{replay.data, MAGIC.size()};
+  if (reader.u16() != VERSION) return std::nullopt;
+  replay.tickRate = reader.u16();
+  replay.keyframeInterval = reader.u16();
+  replay.slotCount = reader.u16();
+  replay.frameCount = reader.u32();
+  const uint32_t keyframeCount = reader.u32();
+
+  if (replay.tickRate == 0 || replay.keyframeInterval == 0 ||
+      replay.slotCount > MatchKinematics::CAPACITY ||
+      keyframeCount !=
+          (replay.frameCount + replay.keyframeInterval - 1) /
+              replay.keyframeInterval)
+  {
+    return std::nullopt;
+  }
+
+  replay.homeSlotsOffset = reader.pos;
+  replay.indexOffset = replay.homeSlotsOffset + replay.slotCount;
+  replay.framesOffset = replay.indexOffset + size_t{keyframeCount} * 4;
+  if (replay.framesOffset > replay.data.size()) return std::nullopt;
+
+  // Walk every frame once so that frameAt() never reads out of bounds
+  const size_t channels = channelCount(replay.slotCount);
+  Reader index{replay.data, replay.indexOffset};
+  Reader frames{replay.data, replay.framesOffset};
+  for (uint32_t f = 0; f < replay.frameCount; ++f)
+  {
+    if (f % replay.keyframeInterval == 0)
+    {
+      if (replay.framesOffset + index.u32() != frames.pos) return std::nullopt;
+      for (size_t c = 0; c < channels; ++c) frames.u16();
+    }
+    else
+    {
+      for (size_t c = 0; c < channels; ++c) frames.delta();
+    }
+    if (!frames.ok) return std::nullopt;
+  }
+  return replay;
+}
+
+std::optional<MatchReplay> MatchReplay::load(const std::string& path)
+{
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return std::nullopt;
+
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)),
+                             std::istreambuf_iterator<char>());
+  return fromBytes(std::move(bytes));
+}
+
+bool MatchReplay::isHomeSlot(size_t slot) const
+{
+  return slot < slotCount && data[homeSlotsOffset + slot] != 0;
+}
+
+ReplayFrame MatchReplay::frameAt(uint32_t frame) const
+{
+  ReplayFrame result;
+  if (frameCount == 0) return result;
+  frame = std::min(frame, frameCount - 1);
+
+  // Start from the closest keyframe, then apply the deltas up to the frame
+  const uint32_t keyframe = frame / keyframeInterval;
+  Reader index{data, indexOffset + size_t{keyframe} * 4};
+  Reader reader{data, framesOffset + index.u32()};
+
+  std::array<uint16_t, channelCount(MatchKinematics::CAPACITY)> channels{};
+  const size_t count = channelCount(slotCount);
+  for (size_t c = 0; c < count; ++c) channels[c] = reader.u16();
+  for (uint32_t f = keyframe * keyframeInterval; f < frame; ++f)
+  {
+    for (size_t c = 0; c < count; ++c)
+    {
+      channels[c] = static_cast<uint16_t>(channels[c] + reader.delta());
+    }
+  }
+
+  for (size_t i = 0; i < slotCount; ++i)
+  {
+    result.players[i] = {dequantizePosition(channels[i * 2]),
+                         dequantizePosition(channels[i * 2 + 1])};
+  }
+  result.ball = {dequantizePosition(channels[slotCount * 2]),
+                 dequantizePosition(channels[slotCount * 2 + 1])};
+  result.timeMinute =
+      static_cast<float>(channels[slotCount * 2 + 2]) / TIME_SCALE;
+  result.homeScore = channels[slotCount * 2 + 3];
+  result.awayScore = channels[slotCount * 2 + 4];
+  return result;
+}
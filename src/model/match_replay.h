@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "global/types.h"
+#include "model/match_kinematics.h"
+
+class MatchEngine;
+
+/**
+ * @struct ReplayFrame
+ * @brief Decoded state of one recorded tick.
+ */
+struct ReplayFrame
+{
+  std::array<Vector2F, MatchKinematics::CAPACITY> players{};
+  Vector2F ball = {0.5f, 0.5f};
+  float timeMinute = 0.0f;
+  int homeScore = 0;
+  int awayScore = 0;
+};
+
+/**
+ * @class MatchReplayRecorder
+ * @brief Encodes the state of every tick of a match into a replay.
+ *
+ * Attach it with MatchEngine::setRecorder(). Every tick is stored as a set of
+ * 16-bit channels: x and y of each player slot and of the ball in fixed point
+ * over [0, 1], the match clock in hundredths of a minute and both scores.
+ * Every KEYFRAME_INTERVAL ticks the channels are written raw; the ticks in
+ * between store the zigzag varint delta of each channel from the previous
+ * tick, mostly one or two bytes. A full match takes about 200 KB.
+ *
+ * File layout, little endian:
+ *   "FMRP", version, tick rate, keyframe interval, slot count (u16 each),
+ *   frame count, keyframe count (u32 each), one home flag byte per slot,
+ *   one u32 frame data offset per keyframe, frame data.
+ */
+class MatchReplayRecorder
+{
+ public:
+  /** @brief Ticks between two raw frames, the most a seek has to decode. */
+  static constexpr uint32_t KEYFRAME_INTERVAL = 60;
+
+  /** @brief Appends the engine's current state as the next frame. */
+  void capture(const MatchEngine& engine);
+
+  uint32_t getFrameCount() const { return frameCount; }
+
+  /** @brief The encoded replay, header included. */
+  std::vector<uint8_t> toBytes() const;
+
+  /**
+   * @brief Writes the replay to @p path, creating its directory.
+   * @return false if the file could not be written.
+   */
+  bool save(const std::string& path) const;
+
+ private:
+  uint16_t tickRate = 0;
+  std::vector<uint8_t> homeSlots;
+  std::vector<uint16_t> previous;
+  std::vector<uint8_t> frames;
+  std::vector<uint32_t> keyframes;
+  uint32_t frameCount = 0;
+};
+
+/**
+ * @class MatchReplay
+ * @brief Read-only view of an encoded replay.
+ *
+ * The whole file is held in a single buffer and frames are decoded on
+ * demand, so seeking to any tick costs at most KEYFRAME_INTERVAL deltas.
+ */
+class MatchReplay
+{
+ public:
+  /** @brief Parses a replay, or returns nothing if it is malformed. */
+  static std::optional<MatchReplay> fromBytes(std::vector<uint8_t> bytes);
+
+  /** @brief Reads and parses a replay file. */
+  static std::optional<MatchReplay> load(const std::string& path);
+
+  uint32_t getFrameCount() const { return frameCount; }
+  int getTickRate() const { return tickRate; }
+  size_t getSlotCount() const { return slotCount; }
+  bool isHomeSlot(size_t slot) const;
+
+  /** @brief Decodes the frame recorded at @p frame, clamped to the last. */
+  ReplayFrame frameAt(uint32_t frame) const;
+
+ private:
+  std::vector<uint8_t> data;
+  int tickRate = 0;
+  uint32_t keyframeInterval = 0;
+  size_t slotCount = 0;
+  uint32_t frameCount = 0;
+  size_t homeSlotsOffset = 0;
+  size_t indexOffset = 0;
+  size_t framesOffset = 0;
+};
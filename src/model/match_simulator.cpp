@@ -0,0 +1,205 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include "match_simulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "global/random_stream.h"
+#include "model/match_engine_batch.h"
+
+namespace
+{
+float averageOverall(const Lineup& lineup, const StatsConfig& config)
+{
+  float sum = 0.0f;
+  int count = 0;
+  if (const Player* gk = lineup.getGoalkeeper())
+  {
+    sum += static_cast<float>(gk->getOverall(config));
+    count++;
+  }
+  for (const auto& p : lineup.getOutfieldPlayers())
+  {
+    if (p.player)
+    {
+      sum += static_cast<float>(p.player->getOverall(config));
+      count++;
+    }
+  }
+  return count > 0 ? sum / static_cast<float>(count) : 50.0f;
+}
+
+// Poisson by inversion: walks the distribution function up to a uniform draw
+int drawGoals(RandomStream& rng, float expected)
+{
+  const float u = rng.uniform();
+  float p = std::exp(-expected);
+  float cumulative = p;
+  int goals = 0;
+  while (u > cumulative && goals < StatisticalSimulator::MAX_GOALS)
+  {
+    ++goals;
+    p *= expected / static_cast<float>(goals);
+    cumulative += p;
+  }
+  return goals;
+}
+}  // namespace
+
+std::vector<MatchScore> MatchSimulator::simulateMany(const Team& home,
+                                                    const Team& away,
+                                                    const StatsConfig& config,
+                                                    uint64_t first_seed,
+                                                    size_t count) const
+{
+  std::vector<MatchScore> scores;
+  scores.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    scores.push_back(simulate(home, away, config, first_seed + i));
+  }
+  return scores;
+}
+
+const MatchSimulator& MatchSimulator::forTier(SimulationTier tier)
+{
+  static const StatisticalSimulator statistical;
+  static const PhysicsSimulator reduced(PhysicsSimulator::REDUCED_TICK_RATE);
+  static const PhysicsSimulator full;
+
+  switch (tier)
+  {
+    case SimulationTier::STATISTICAL:
+      return statistical;
+    case SimulationTier::REDUCED_PHYSICS:
+      return reduced;
+    case SimulationTier::FULL_PHYSICS:
+      break;
+  }
+  return full;
+}
+
+float StatisticalSimulator::expectedGoals(float own, float opponent, bool home)
+{
+  const float scale = home ? 2.5f : 2.0f;
+  return std::max(0.1f, (own / 100.0f) * scale + (own - opponent) / 20.0f);
+}
+
+MatchScore StatisticalSimulator::simulate(const Team& home, const Team& away,
+                                          const StatsConfig& config,
+                                          uint64_t seed) const
+{
+  const float homeOvr = averageOverall(home.getLineup(), config);
+  const float awayOvr = averageOverall(away.getLineup(), config);
+
+  // Drawn from uniforms rather than std::poisson_distribution, so scores are
+  // identical on every standard library
+  RandomStream rng(seed);
+  MatchScore score;
+  score.home = drawGoals(rng, expectedGoals(homeOvr, awayOvr, true));
+  score.away = drawGoals(rng, expectedGoals(awayOvr, homeOvr, false));
+  return score;
+}
+
+MatchScore PhysicsSimulator::simulate(const Team& home, const Team& away,
+                                      const StatsConfig& config,
+                                      uint64_t seed) const
+{
+  MatchEnginePool::Lease engine =
+      engines.acquire(home.getLineup(), away.getLineup(), home.getStrategy(),
+                      away.getStrategy(), config, seed);
+  engine->simulateToEnd(seed, ticksPerMinute);
+  return {engine->getHomeScore(), engine->getAwayScore()};
+}
+
+std::vector<MatchScore> PhysicsSimulator::simulateMany(
+    const Team& home, const Team& away, const StatsConfig& config,
+    uint64_t first_seed, size_t count) const
+{
+  MatchEngineBatch batch;
+  for (size_t i = 0; i < count; ++i)
+  {
+    batch.add(home.getLineup(), away.getLineup(), home.getStrategy(),
+              away.getStrategy(), config, first_seed + i);
+  }
+  batch.simulateToEnd(ticksPerMinute);
+
+  std::vector<MatchScore> scores;
+  scores.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    scores.push_back({batch[i].getHomeScore(), batch[i].getAwayScore()});
+  }
+  return scores;
+}
+
+MatchPrediction sampleOutcomes(const MatchSimulator& simulator,
+                               const Team& home, const Team& away,
+                               const StatsConfig& config, int runs,
+                               ThreadPool& pool)
+{
+  std::vector<MatchScore> scores(static_cast<size_t>(std::max(runs, 0)));
+  constexpr size_t CHUNK = MatchEngineBatch::LANES;
+  pool.parallelFor(
+      (scores.size() + CHUNK - 1) / CHUNK,
+      [&](size_t chunk)
+      {
+        const size_t first = chunk * CHUNK;
+        const size_t count = std::min(CHUNK, scores.size() - first);
+        std::vector<MatchScore> results =
+            simulator.simulateMany(home, away, config, first, count);
+        std::copy(results.begin(), results.end(),
+                  scores.begin() + static_cast<ptrdiff_t>(first));
+      });
+
+  MatchPrediction prediction;
+  prediction.requestedRuns = runs;
+  prediction.completedRuns = runs;
+  if (scores.empty()) return prediction;
+
+  const float share = 1.0f / static_cast<float>(scores.size());
+  for (const MatchScore& score : scores)
+  {
+    if (score.home > score.away) prediction.homeWin += share;
+    if (score.home == score.away) prediction.draw += share;
+    if (score.home < score.away) prediction.awayWin += share;
+    prediction.expectedHomeGoals += static_cast<float>(score.home) * share;
+    prediction.expectedAwayGoals += static_cast<float>(score.away) * share;
+    prediction.homeGoals[std::min(score.home, MatchPrediction::MAX_GOALS)] +=
+        share;
+    prediction.awayGoals[std::min(score.away, MatchPrediction::MAX_GOALS)] +=
+        share;
+  }
+  return prediction;
+}
+
+TierCalibration compareOutcomes(const MatchPrediction& tier,
+                                const MatchPrediction& reference)
+{
+  TierCalibration calibration;
+  calibration.goalError =
+      std::max(std::abs(tier.expectedHomeGoals - reference.expectedHomeGoals),
+               std::abs(tier.expectedAwayGoals - reference.expectedAwayGoals));
+  calibration.resultError =
+      std::max({std::abs(tier.homeWin - reference.homeWin),
+                std::abs(tier.draw - reference.draw),
+                std::abs(tier.awayWin - reference.awayWin)});
+
+  float homeDistance = 0.0f;
+  float awayDistance = 0.0f;
+  for (size_t k = 0; k < tier.homeGoals.size(); ++k)
+  {
+    homeDistance += std::abs(tier.homeGoals[k] - reference.homeGoals[k]);
+    awayDistance += std::abs(tier.awayGoals[k] - reference.awayGoals[k]);
+  }
+  calibration.goalDistance = 0.5f * std::max(homeDistance, awayDistance);
+  return calibration;
+}
@@ -11,7 +11,6 @@
 #include <cmath>
 #include <cstdint>
 #include <map>
-#include <random>
 #include <string>
 #include <utility>
 
@@ -122,34 +121,25 @@ void Player::agePlayer()
   }
 }
 
-bool Player::checkRetirement() const
+bool Player::checkRetirement(RandomStream& rng) const
 {
   if (_age < PLAYER_RETIREMENT_AGE_THRESHOLD) return false;
 
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  std::uniform_real_distribution<float> dis(0.0f, 1.0f);
-
   float retirementChance =
       PLAYER_RETIREMENT_BASE_CHANCE +
       (static_cast<float>(_age) - PLAYER_RETIREMENT_AGE_THRESHOLD) *
           PLAYER_RETIREMENT_CHANCE_INCREASE_PER_YEAR;
 
-  return dis(gen) < retirementChance;
+  return rng.uniform() < retirementChance;
 }
 
-void Player::train(const std::vector<std::string>& focus_stats)
+void Player::train(const std::vector<std::string>& focus_stats,
+                   RandomStream& rng)
 {
   if (focus_stats.empty()) return;
 
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  std::uniform_int_distribution<> stat_dis(
-      0, static_cast<int>(focus_stats.size() - 1));
-  std::uniform_real_distribution<float> rand_dist(0.0f, 1.0f);
-
   const std::string& random_stat =
-      focus_stats[static_cast<size_t>(stat_dis(gen))];
+      focus_stats[rng.below(static_cast<uint32_t>(focus_stats.size()))];
 
   auto it = _stats.find(random_stat);
   if (it == _stats.end()) return;
@@ -157,7 +147,7 @@ void Player::train(const std::vector<std::string>& focus_stats)
   float age_factor =
       ((PLAYER_AGE_FACTOR_DECLINE_AGE - static_cast<float>(_age)) *
        PLAYER_AGE_FACTOR_DECAY_RATE);
-  float random_factor = rand_dist(gen);
+  float random_factor = rng.uniform();
 
   float increment = PLAYER_STAT_INCREASE_BASE * (random_factor * age_factor);
   it->second += increment;
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "global/languages.h"
+#include "global/random_stream.h"
 #include "global/stats_config.h"
 #include "global/types.h"
 
@@ -131,15 +132,17 @@ class Player
 
   /**
    * @brief Checks if the player is ready for retirement.
+   * @param rng Stream the retirement roll is drawn from.
    * @return True if the player retires, false otherwise.
    */
-  bool checkRetirement() const;
+  bool checkRetirement(RandomStream& rng) const;
 
   /**
    * @brief Trains the player, improving specific focus stats.
    * @param focus_stats The stats to focus on during training.
+   * @param rng Stream the trained stat and the improvement are drawn from.
    */
-  void train(const std::vector<std::string>& focus_stats);
+  void train(const std::vector<std::string>& focus_stats, RandomStream& rng);
 
   // Market Value & Transfer Logic
 
@@ -0,0 +1,129 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Thin wrappers over the SIMD instruction sets used by the match kernels, so
+// one kernel template serves every width. Include from source files only.
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// 8 lanes for AVX2 targets. Every operation below is an AVX1 instruction (the
+// float arithmetic, compares and blends; AVX2 only adds integer ops), so the
+// path is gated on __AVX__ and AVX1-only CPUs take it too.
+#if defined(__AVX__)
+struct AvxOps
+{
+  using V = __m256;
+  static constexpr size_t WIDTH = 8;
+
+  static V load(const float* p) { return _mm256_load_ps(p); }
+  static void store(float* p, V v) { _mm256_store_ps(p, v); }
+  static V set1(float f) { return _mm256_set1_ps(f); }
+  static V add(V a, V b) { return _mm256_add_ps(a, b); }
+  static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+  static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+  static V div(V a, V b) { return _mm256_div_ps(a, b); }
+  static V sqrt(V a) { return _mm256_sqrt_ps(a); }
+  static V lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static V eq(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+  static V both(V a, V b) { return _mm256_and_ps(a, b); }
+  static bool any(V mask) { return _mm256_movemask_ps(mask) != 0; }
+  // mask ? a : b
+  static V select(V mask, V a, V b) { return _mm256_blendv_ps(b, a, mask); }
+};
+#endif
+
+#if defined(__SSE2__)
+struct SseOps
+{
+  using V = __m128;
+  static constexpr size_t WIDTH = 4;
+
+  static V load(const float* p) { return _mm_load_ps(p); }
+  static void store(float* p, V v) { _mm_store_ps(p, v); }
+  static V set1(float f) { return _mm_set1_ps(f); }
+  static V add(V a, V b) { return _mm_add_ps(a, b); }
+  static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+  static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+  static V div(V a, V b) { return _mm_div_ps(a, b); }
+  static V sqrt(V a) { return _mm_sqrt_ps(a); }
+  static V lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+  static V eq(V a, V b) { return _mm_cmpeq_ps(a, b); }
+  static V both(V a, V b) { return _mm_and_ps(a, b); }
+  static bool any(V mask) { return _mm_movemask_ps(mask) != 0; }
+  // mask ? a : b
+  static V select(V mask, V a, V b)
+  {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+  }
+};
+#endif
+
+#if defined(__AVX512F__)
+// Only used across matches: 16 lanes are too wide for the players of one
+struct Avx512Ops
+{
+  using V = __m512;
+  static constexpr size_t WIDTH = 16;
+  static V load(const float* p) { return _mm512_load_ps(p); }
+  static void store(float* p, V v) { _mm512_store_ps(p, v); }
+  static V set1(float f) { return _mm512_set1_ps(f); }
+  static V add(V a, V b) { return _mm512_add_ps(a, b); }
+  static V sub(V a, V b) { return _mm512_sub_ps(a, b); }
+  static V mul(V a, V b) { return _mm512_mul_ps(a, b); }
+  static V div(V a, V b) { return _mm512_div_ps(a, b); }
+  // Full mask: GCC 12 warns about the undefined source of _mm512_sqrt_ps
+  static V sqrt(V a) { return _mm512_maskz_sqrt_ps(0xFFFF, a); }
+  static __mmask16 lt(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+  static __mmask16 eq(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+  static __mmask16 both(__mmask16 a, __mmask16 b) { return a & b; }
+  static bool any(__mmask16 mask) { return mask != 0; }
+  // mask ? a : b
+  static V select(__mmask16 mask, V a, V b)
+  {
+    return _mm512_mask_blend_ps(mask, b, a);
+  }
+};
+#endif
+
+// One lane, for batches on targets without SIMD
+struct ScalarOps
+{
+  using V = float;
+  static constexpr size_t WIDTH = 1;
+  static V load(const float* p) { return *p; }
+  static void store(float* p, V v) { *p = v; }
+  static V set1(float f) { return f; }
+  static V add(V a, V b) { return a + b; }
+  static V sub(V a, V b) { return a - b; }
+  static V mul(V a, V b) { return a * b; }
+  static V div(V a, V b) { return a / b; }
+  static V sqrt(V a) { return std::sqrt(a); }
+  static bool lt(V a, V b) { return a < b; }
+  static bool eq(V a, V b) { return a == b; }
+  static bool both(bool a, bool b) { return a && b; }
+  static bool any(bool mask) { return mask; }
+  static V select(bool mask, V a, V b) { return mask ? a : b; }
+};
+
+// Widest set, one lane per match in MatchKinematicsBatch
+#if defined(__AVX512F__)
+using LaneOps = Avx512Ops;
+#elif defined(__AVX__)
+using LaneOps = AvxOps;
+#elif defined(__SSE2__)
+using LaneOps = SseOps;
+#else
+using LaneOps = ScalarOps;
+#endif
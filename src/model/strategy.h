@@ -37,6 +37,8 @@ struct StrategySliders
       0.5f;                 /**< Likelihood to pass forward vs. safer options */
   float widthUsage = 0.5f;  /**< Horizontal spread of the team */
   float compactness = 0.5f; /**< Closeness of players to the goalkeeper */
+
+  bool operator==(const StrategySliders&) const = default;
 };
 
 /**
@@ -59,6 +61,8 @@ struct RoleWeights
   float attackWeight = 0.5f;  /**< Tendency to engage in offensive actions */
   float defenseWeight = 0.5f; /**< Tendency to engage in defensive actions */
   int movementRadius = 1;     /**< Distance from lineup position */
+
+  bool operator==(const RoleWeights&) const = default;
 };
 
 /**
@@ -75,6 +79,8 @@ class Strategy
    */
   Strategy();
 
+  bool operator==(const Strategy&) const = default;
+
   /**
    * @brief Get weights of a player at a specific grid cell.
    *
@@ -12,6 +12,9 @@
 #include <memory>
 
 #include "database/database_connection.h"
+#include "database/repositories/fixture_repository.h"
+#include "database/repositories/game_state_repository.h"
+#include "database/repositories/heatmap_repository.h"
 #include "database/repositories/league_repository.h"
 #include "database/repositories/player_repository.h"
 #include "database/repositories/team_repository.h"
@@ -126,3 +129,113 @@ TEST_F(DatabaseTest, Transactions)
   players = playerRepo.loadAllPlayers();
   EXPECT_EQ(players.size(), 2);
 }
+
+TEST_F(DatabaseTest, NestedTransactions)
+{
+  PlayerRepository playerRepo(getDbConn());
+  Player p1(1, 10, "A", "B", PlayerRole::ST, Language::EN, 1000, 0, 20, 2, 180,
+            Foot::Right, {});
+  Player p2(2, 10, "C", "D", PlayerRole::ST, Language::EN, 1000, 0, 20, 2, 180,
+            Foot::Right, {});
+
+  // An inner rollback only undoes the work since its own begin
+  getDbConn()->beginTransaction();
+  playerRepo.insertPlayerWithId(p1);
+  getDbConn()->beginTransaction();
+  playerRepo.insertPlayerWithId(p2);
+  getDbConn()->rollbackTransaction();
+  getDbConn()->commitTransaction();
+
+  auto players = playerRepo.loadAllPlayers();
+  ASSERT_EQ(players.size(), 1);
+  EXPECT_EQ(players[0].getFirstName(), "A");
+
+  // An inner commit is still undone by the outer rollback
+  getDbConn()->beginTransaction();
+  getDbConn()->beginTransaction();
+  playerRepo.insertPlayerWithId(p2);
+  getDbConn()->commitTransaction();
+  getDbConn()->rollbackTransaction();
+
+  players = playerRepo.loadAllPlayers();
+  EXPECT_EQ(players.size(), 1);
+}
+
+TEST_F(DatabaseTest, SaveAndLoadSeasonHeatmaps)
+{
+  HeatmapRepository heatmapRepo(getDbConn());
+
+  PlayerHeatmap match;
+  match.add(PlayerHeatmap::cellAt(0.05f, 0.5f), 1500);
+  match.add(PlayerHeatmap::cellAt(0.2f, 0.45f), 300);
+  std::unordered_map<PlayerID, SeasonHeatmap> heatmaps;
+  heatmaps[7].add(match);
+  heatmaps[7].add(match);
+  heatmaps[9].add(match);
+  heatmapRepo.saveSeason(2, heatmaps);
+
+  // Saving again replaces the season's rows
+  heatmaps[9].add(match);
+  heatmapRepo.saveSeason(2, heatmaps);
+
+  auto loaded = heatmapRepo.loadSeason(2);
+  ASSERT_EQ(loaded.size(), 2);
+  EXPECT_EQ(loaded[7].cells, heatmaps[7].cells);
+  EXPECT_EQ(loaded[9].matches, 2);
+  EXPECT_EQ(loaded[9].peak(), 3000u);
+  EXPECT_TRUE(heatmapRepo.loadSeason(1).empty());
+}
+
+TEST_F(DatabaseTest, SaveAndLoadRandomState)
+{
+  GameStateRepository gameStateRepo(getDbConn());
+  RandomService loaded;
+  EXPECT_FALSE(gameStateRepo.loadRandomState(loaded));
+
+  RandomService random(1234);
+  for (int i = 0; i < 5; ++i) random.stream(RandomService::TRAINING)();
+  random.stream(RandomService::TRANSFERS)();
+  gameStateRepo.saveRandomState(random);
+
+  // The loaded streams go on with the draws the saved ones would make
+  ASSERT_TRUE(gameStateRepo.loadRandomState(loaded));
+  EXPECT_EQ(loaded.getSeed(), 1234u);
+  for (uint8_t id = 0; id < RandomService::STREAM_COUNT; ++id)
+  {
+    const auto stream = static_cast<RandomService::Stream>(id);
+    EXPECT_EQ(loaded.stream(stream)(), random.stream(stream)());
+  }
+}
+
+TEST_F(DatabaseTest, SaveFixtureResults)
+{
+  FixtureRepository fixtureRepo(getDbConn());
+  const GameDateValue date(2025, 8, 16);
+  Calendar calendar;
+  calendar.addMatch(Match(1, 2, date, MatchType::LEAGUE));
+  calendar.addMatch(Match(3, 4, date, MatchType::LEAGUE));
+  fixtureRepo.saveCalendar(calendar);
+
+  // Only the played match of the matchday gets a result
+  std::vector<Match>& matches = calendar.getMatchesForDateMutable(date);
+  matches[0].setPlayedResult(2, 1);
+  fixtureRepo.saveResults(matches);
+
+  Calendar loaded;
+  fixtureRepo.loadCalendar(loaded);
+  const auto& loaded_matches = loaded.getMatchesForDate(date);
+  ASSERT_EQ(loaded_matches.size(), 2);
+  for (const Match& match : loaded_matches)
+  {
+    if (match.getHomeTeamId() == 1)
+    {
+      EXPECT_TRUE(match.isPlayed());
+      EXPECT_EQ(match.getHomeScore(), 2);
+      EXPECT_EQ(match.getAwayScore(), 1);
+    }
+    else
+    {
+      EXPECT_FALSE(match.isPlayed());
+    }
+  }
+}
@@ -9,6 +9,7 @@
 #include <SDL3/SDL.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -24,6 +25,7 @@
 #include "gui/scenes/strategy_scene.h"
 #include "gui/scenes/team_selection_scene.h"
 #include "model/game.h"
+#include "model/game_scheduler.h"
 #include "model/player.h"
 #include "model/team.h"
 
@@ -86,6 +88,129 @@ TEST_F(GameFlowTest, FullLifecycle)
   EXPECT_EQ(controller->getManagedTeam()->get().getId(), firstTeamId);
 }
 
+TEST_F(GameFlowTest, FastForward)
+{
+  // Without a managed team nothing stops the run early
+  controller->advanceUntil(
+      GameController::AdvanceTarget::TRANSFER_WINDOW_CLOSE);
+  EXPECT_FALSE(controller->isTransferWindowOpen());
+
+  auto teams = controller->getTeams();
+  ASSERT_FALSE(teams.empty());
+  const TeamID managed_id = teams.front().get().getId();
+  controller->selectManagedTeam(managed_id);
+
+  // Stops on the day of the next match of the managed team
+  EXPECT_GT(controller->advanceUntil(
+                GameController::AdvanceTarget::NEXT_MANAGED_FIXTURE),
+            0);
+  const Game* game = controller->getGame();
+  const GameDateValue matchday = controller->getCurrentDate();
+  const auto& today = game->getCalendar().getMatchesForDate(matchday);
+  auto is_managed = [managed_id](const Match& m)
+  { return m.getHomeTeamId() == managed_id || m.getAwayTeamId() == managed_id; };
+  auto managed_match = std::ranges::find_if(today, is_managed);
+  ASSERT_NE(managed_match, today.end());
+
+  // Results are kept in the calendar itself, except the managed team's match,
+  // which is left for the user to play
+  EXPECT_FALSE(managed_match->isPlayed());
+  for (const Match& m : today)
+  {
+    if (!is_managed(m))
+    {
+      EXPECT_TRUE(m.isPlayed());
+    }
+  }
+  auto next = controller->getNextFixture(managed_id);
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ(next->getDate(), matchday);
+
+  // The played result counts towards the standings, once
+  const League& league =
+      controller->getLeagueById(teams.front().get().getLeagueId())->get();
+  const int points = league.getPoints(managed_id);
+  const int win = managed_match->getMatchType() == MatchType::LEAGUE ? 3 : 0;
+  const TeamID home_id = managed_match->getHomeTeamId();
+  const TeamID away_id = managed_match->getAwayTeamId();
+  const uint8_t managed_goals = 2;
+  controller->setMatchResult(matchday, home_id, away_id,
+                             home_id == managed_id ? managed_goals : 0,
+                             away_id == managed_id ? managed_goals : 0);
+  EXPECT_TRUE(managed_match->isPlayed());
+  EXPECT_EQ(league.getPoints(managed_id), points + win);
+  controller->setMatchResult(matchday, home_id, away_id, 0, 0);
+  EXPECT_EQ(league.getPoints(managed_id), points + win);
+
+  const GameDateValue before = controller->getCurrentDate();
+  const int advanced = controller->advanceDays(3);
+  EXPECT_GE(advanced, 1);
+  EXPECT_LE(advanced, 3);
+  EXPECT_EQ(before + static_cast<size_t>(advanced),
+            controller->getCurrentDate());
+}
+
+TEST_F(GameFlowTest, SeasonTimings)
+{
+  Game* game = controller->getGame();
+  game->setSimulationTierOverride(SimulationTier::STATISTICAL);
+  game->getTimings() = {};
+
+  const int season = controller->getCurrentSeason();
+  controller->advanceUntil(GameController::AdvanceTarget::SEASON_END);
+  EXPECT_EQ(controller->getCurrentSeason(), season + 1);
+
+  const GameTimings& timings = game->getTimings();
+  EXPECT_GT(timings.elapsed[GameTimings::MATCHES].count(), 0);
+  EXPECT_GT(timings.elapsed[GameTimings::TRAINING].count(), 0);
+  EXPECT_GT(timings.elapsed[GameTimings::AI_TRANSFERS].count(), 0);
+  EXPECT_GT(timings.elapsed[GameTimings::PERSISTENCE].count(), 0);
+  EXPECT_GT(timings.elapsed[GameTimings::SEASON_ROLLOVER].count(), 0);
+}
+
+TEST(GameSchedulerTest, QueuesSeasonEventsInOrder)
+{
+  Calendar calendar;
+  calendar.addMatch(Match(1, 2, GameDateValue(2025, 9, 7), MatchType::LEAGUE));
+  calendar.addMatch(Match(3, 4, GameDateValue(2025, 9, 7), MatchType::LEAGUE));
+
+  GameScheduler scheduler;
+  scheduler.scheduleSeason(calendar, GameDateValue(2025, 7, 2));
+  std::vector<GameEvent> events;
+
+  // A market tick for each remaining day of the summer window
+  scheduler.popDue(GameDateValue(2025, 8, 31), events);
+  EXPECT_EQ(events.size(), 60u);
+  EXPECT_TRUE(std::ranges::all_of(
+      events, [](const GameEvent& e)
+      { return e.type == GameEventType::MARKET_TICK; }));
+
+  // Then straight to the window close and the fixture day, one event each
+  EXPECT_EQ(scheduler.nextDate(), GameDateValue(2025, 9, 1));
+  scheduler.popDue(GameDateValue(2025, 9, 1), events);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].type, GameEventType::TRANSFER_WINDOW_CLOSE);
+
+  EXPECT_EQ(scheduler.nextDate(), GameDateValue(2025, 9, 7));
+  scheduler.popDue(GameDateValue(2025, 9, 7), events);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].type, GameEventType::FIXTURES);
+  EXPECT_EQ(events[1].type, GameEventType::TRAINING);
+
+  EXPECT_EQ(scheduler.nextDate(), GameDateValue(2026, 1, 1));
+  scheduler.popDue(GameDateValue(2026, 1, 1), events);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].type, GameEventType::TRANSFER_WINDOW_OPEN);
+  EXPECT_EQ(events[1].type, GameEventType::MARKET_TICK);
+
+  // The rollover comes first on its day and ends the season's events
+  scheduler.popDue(GameDateValue(2026, 7, 1), events);
+  ASSERT_GE(events.size(), 2u);
+  EXPECT_EQ(events[events.size() - 2].type, GameEventType::SEASON_ROLLOVER);
+  EXPECT_EQ(events.back().type, GameEventType::MARKET_TICK);
+  EXPECT_EQ(scheduler.size(), 0u);
+}
+
 TEST_F(GameFlowTest, GUIFlowLifecycle)
 {
   // Enable headless SDL for testing
@@ -8,13 +8,66 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <future>
 #include <memory>
+#include <new>
+#include <random>
+#include <thread>
 #include <vector>
 
+#include "global/thread_pool.h"
 #include "model/match_engine.h"
+#include "model/match_engine_batch.h"
+#include "model/match_heatmap.h"
+#include "model/match_predictor.h"
+#include "model/match_replay.h"
+#include "model/match_simulator.h"
 #include "model/player.h"
 #include "model/team.h"
 
+// Replaced for the whole test binary to count the heap allocations of the
+// calling thread, which proves a code path allocation free
+namespace
+{
+thread_local size_t allocationCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+  ++allocationCount;
+  if (void* p = std::malloc(std::max<std::size_t>(size, 1))) return p;
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  ++allocationCount;
+  const auto align = static_cast<std::size_t>(alignment);
+  const std::size_t rounded = (std::max<std::size_t>(size, 1) + align - 1) /
+                              align * align;
+  if (void* p = std::aligned_alloc(align, rounded)) return p;
+  throw std::bad_alloc();
+}
+
+// Not inlined: GCC takes a free() inlined next to a new for a mismatch
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+[[gnu::noinline]] void operator delete(void* p, std::align_val_t) noexcept
+{
+  std::free(p);
+}
+[[gnu::noinline]] void operator delete(void* p, std::size_t,
+                                       std::align_val_t) noexcept
+{
+  std::free(p);
+}
+
 // Helper function to create a dummy team with a specific overall rating
 Team createDummyTeam(TeamID id, const std::string& name, int rating,
                      std::vector<std::unique_ptr<Player>>& dummy_players)
@@ -112,3 +165,1190 @@ TEST(MatchEngineTest, StatAdvantage)
   // We only verify that the match engine ran and scores were tracked.
   EXPECT_GE(engine.getHomeScore() + engine.getAwayScore(), 0);
 }
+
+// Helper that weights the four dummy stats equally for every role
+StatsConfig createUniformConfig()
+{
+  StatsConfig config;
+  config.possible_stats = {"Pace", "Shooting", "Passing", "Defending"};
+  for (const char* role :
+       {"Goalkeeper", "Defender", "Midfielder", "Striker", "Unknown"})
+  {
+    config.role_focus[role] = {{"Pace", "Shooting", "Passing", "Defending"},
+                               {0.25, 0.25, 0.25, 0.25}};
+  }
+  return config;
+}
+
+TEST(MatchEngineTest, HeadlessRunReachesFullTime)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 60, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  engine.simulateToEnd(7);
+
+  EXPECT_TRUE(engine.isFinished());
+  EXPECT_GE(engine.getMatchTimeMinutes(), MatchEngine::MATCH_LENGTH_MINUTES);
+}
+
+TEST(MatchEngineTest, HeadlessRunIsReproducibleForSeed)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 55, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine first(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config);
+  MatchEngine second(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  first.simulateToEnd(1234);
+  second.simulateToEnd(1234);
+
+  EXPECT_EQ(first.getHomeScore(), second.getHomeScore());
+  EXPECT_EQ(first.getAwayScore(), second.getAwayScore());
+}
+
+TEST(MatchEngineTest, InterleavedEnginesMatchIsolatedRuns)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 65, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 65, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  // Reference runs, one engine at a time
+  MatchEngine refA(home.getLineup(), away.getLineup(), home.getStrategy(),
+                   away.getStrategy(), config, 11);
+  MatchEngine refB(home.getLineup(), away.getLineup(), home.getStrategy(),
+                   away.getStrategy(), config, 22);
+  while (!refA.isFinished()) refA.update(0.05f);
+  while (!refB.isFinished()) refB.update(0.05f);
+
+  // Same seeds, stepped alternately: no state may leak between engines
+  MatchEngine a(home.getLineup(), away.getLineup(), home.getStrategy(),
+                away.getStrategy(), config, 11);
+  MatchEngine b(home.getLineup(), away.getLineup(), home.getStrategy(),
+                away.getStrategy(), config, 22);
+  while (!a.isFinished() || !b.isFinished())
+  {
+    a.update(0.05f);
+    b.update(0.05f);
+  }
+
+  EXPECT_EQ(a.getSeed(), 11u);
+  EXPECT_EQ(a.getHomeScore(), refA.getHomeScore());
+  EXPECT_EQ(a.getAwayScore(), refA.getAwayScore());
+  EXPECT_EQ(a.getBall().position.x, refA.getBall().position.x);
+  EXPECT_EQ(b.getHomeScore(), refB.getHomeScore());
+  EXPECT_EQ(b.getAwayScore(), refB.getAwayScore());
+  EXPECT_EQ(b.getBall().position.x, refB.getBall().position.x);
+}
+
+TEST(MatchEngineTest, RandomStreamsAreReplayableAndIndependent)
+{
+  RandomStream root(2026);
+  RandomStream first = root.split(1);
+  RandomStream replay = RandomStream(2026).split(1);
+  RandomStream sibling = root.split(2);
+
+  int collisions = 0;
+  for (int i = 0; i < 1000; ++i)
+  {
+    uint32_t value = first();
+    EXPECT_EQ(value, replay());
+    if (value == sibling()) ++collisions;
+
+    float u = root.uniform();
+    EXPECT_GE(u, 0.0f);
+    EXPECT_LT(u, 1.0f);
+  }
+  EXPECT_EQ(collisions, 0);
+
+  // Seeking lands on the same value as drawing up to that position
+  for (uint64_t position : {0u, 3u, 4u, 7u, 1001u})
+  {
+    RandomStream drawn = RandomStream(7).split(3);
+    for (uint64_t i = 0; i < position; ++i) drawn();
+    RandomStream sought = RandomStream(7).split(3);
+    sought.seek(position);
+    EXPECT_EQ(sought.getPosition(), position);
+    EXPECT_EQ(sought(), drawn());
+  }
+}
+
+TEST(MatchEngineTest, AttributesAreSnapshotAtKickoffAndSubstitution)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 80, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 40, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  for (const MatchPlayer& mp : engine.getPlayers())
+  {
+    EXPECT_FLOAT_EQ(mp.attributes.overall,
+                    static_cast<float>(mp.player->getOverall(config) / 100.0));
+    EXPECT_FLOAT_EQ(mp.attributes.pace, mp.isHomeTeam ? 0.8f : 0.4f);
+    EXPECT_FLOAT_EQ(mp.attributes.goalkeeping, 0.0f);  // Not in the stat map
+  }
+
+  const MatchPlayer& outgoing = engine.getPlayers().back();
+  const uint32_t outgoingId = outgoing.player->getId();
+  std::map<std::string, float> stats = {{"Pace", 90.0f},
+                                        {"Shooting", 90.0f},
+                                        {"Passing", 90.0f},
+                                        {"Defending", 90.0f}};
+  Player sub(999, 2, "Sub", "Player", PlayerRole::ST, Language::EN, 1000, 0,
+             25, 2, 180, Foot::Right, stats);
+  engine.substitutePlayer(outgoingId, &sub);
+
+  const MatchPlayer& incoming = engine.getPlayers().back();
+  EXPECT_EQ(incoming.player, &sub);
+  EXPECT_FLOAT_EQ(incoming.attributes.overall, 0.9f);
+  EXPECT_FLOAT_EQ(incoming.attributes.shooting, 0.9f);
+}
+
+TEST(MatchEngineTest, FormationFollowsStrategyChanges)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 60, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  const MatchFormation before = engine.getFormation();
+
+  Strategy daring = home.getStrategy();
+  StrategySliders sliders = daring.getSliders();
+  sliders.riskTaking = 1.0f;
+  sliders.pressing = 1.0f;
+  daring.setAllSliders(sliders);
+  engine.setStrategy(true, daring);
+
+  const MatchFormation& after = engine.getFormation();
+  for (size_t i = 0; i < engine.getPlayers().size(); ++i)
+  {
+    if (engine.getPlayers()[i].isHomeTeam)
+    {
+      EXPECT_GT(after.attackX[i], before.attackX[i]);
+      EXPECT_FLOAT_EQ(after.pressRadius[i], 0.4f);
+    }
+    else
+    {
+      EXPECT_FLOAT_EQ(after.attackX[i], before.attackX[i]);
+      EXPECT_FLOAT_EQ(after.pressRadius[i], before.pressRadius[i]);
+    }
+  }
+}
+
+TEST(MatchEngineTest, EventStreamCoversWholeMatch)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 75, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 50, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  engine.simulateToEnd(5);
+
+  const auto& events = engine.getEvents();
+  ASSERT_GT(events.size(), 10u);  // History is no longer truncated
+  EXPECT_EQ(events.front().type, MatchEventType::KICKOFF);
+
+  int homeGoals = 0;
+  int awayGoals = 0;
+  for (size_t i = 0; i < events.size(); ++i)
+  {
+    const MatchEvent& ev = events[i];
+    if (i > 0)
+    {
+      EXPECT_GE(ev.tick, events[i - 1].tick);
+    }
+    EXPECT_LE(ev.tick, engine.getTickCount());
+    if (ev.type == MatchEventType::GOAL)
+    {
+      ++(ev.isHomeTeam ? homeGoals : awayGoals);
+    }
+    if (ev.type == MatchEventType::PASS || ev.type == MatchEventType::TACKLE)
+    {
+      EXPECT_NE(ev.actor, 0u);
+      EXPECT_NE(ev.target, 0u);
+    }
+  }
+  EXPECT_EQ(homeGoals, engine.getHomeScore());
+  EXPECT_EQ(awayGoals, engine.getAwayScore());
+}
+
+TEST(MatchEngineTest, EventLogKeepsLatestEventsOnOverflow)
+{
+  MatchEventLog log;
+  const MatchEvent* storage = nullptr;
+  for (uint32_t tick = 0; tick < MatchEventLog::CAPACITY + 10; ++tick)
+  {
+    log.push({MatchEventType::PASS, tick, 0.0f, 1, 2, {}, true});
+    if (tick == 0) storage = log.view().data();
+  }
+
+  // The oldest half was dropped in place, the storage never moved
+  const auto events = log.view();
+  EXPECT_EQ(events.data(), storage);
+  ASSERT_EQ(events.size(), MatchEventLog::CAPACITY / 2 + 10);
+  EXPECT_EQ(events.front().tick, MatchEventLog::CAPACITY / 2);
+  EXPECT_EQ(events.back().tick, MatchEventLog::CAPACITY + 9);
+}
+
+TEST(MatchEngineTest, StatsTallyWithEventStream)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 55, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  engine.simulateToEnd(11);
+  const MatchStats& stats = engine.getStats();
+
+  for (bool side : {true, false})
+  {
+    int shots = 0;
+    int passes = 0;
+    int tackles = 0;
+    for (const MatchEvent& ev : engine.getEvents())
+    {
+      if (ev.isHomeTeam != side) continue;
+      shots += ev.type == MatchEventType::SHOT ? 1 : 0;
+      passes += ev.type == MatchEventType::PASS ? 1 : 0;
+      tackles += ev.type == MatchEventType::TACKLE ? 1 : 0;
+    }
+
+    // Player lines add up to their team's line
+    MatchStatLine sum;
+    for (const MatchPlayer& mp : engine.getPlayers())
+    {
+      if (mp.isHomeTeam != side) continue;
+      const MatchStatLine* line = stats.forPlayer(mp.player->getId());
+      ASSERT_NE(line, nullptr);
+      sum.possessionMinutes += line->possessionMinutes;
+      sum.shots += line->shots;
+      sum.shotsOnTarget += line->shotsOnTarget;
+      sum.passesAttempted += line->passesAttempted;
+      sum.passesCompleted += line->passesCompleted;
+      sum.tackles += line->tackles;
+      sum.expectedGoals += line->expectedGoals;
+    }
+
+    const MatchStatLine& team = stats.team(side);
+    EXPECT_EQ(team.shots, shots);
+    EXPECT_EQ(team.passesAttempted, passes);
+    EXPECT_EQ(team.tackles, tackles);
+    EXPECT_EQ(sum.shots, team.shots);
+    EXPECT_EQ(sum.shotsOnTarget, team.shotsOnTarget);
+    EXPECT_EQ(sum.passesAttempted, team.passesAttempted);
+    EXPECT_EQ(sum.passesCompleted, team.passesCompleted);
+    EXPECT_EQ(sum.tackles, team.tackles);
+    EXPECT_NEAR(sum.possessionMinutes, team.possessionMinutes, 1e-3f);
+    EXPECT_NEAR(sum.expectedGoals, team.expectedGoals, 1e-3f);
+
+    EXPECT_GT(team.passesAttempted, 0);
+    EXPECT_LE(team.passesCompleted, team.passesAttempted);
+    EXPECT_LE(team.shotsOnTarget, team.shots);
+    EXPECT_LE(team.expectedGoals, static_cast<float>(team.shots));
+  }
+
+  const float onBall =
+      stats.home.possessionMinutes + stats.away.possessionMinutes;
+  EXPECT_GT(onBall, 0.0f);
+  EXPECT_LE(onBall, MatchEngine::MATCH_LENGTH_MINUTES);
+  EXPECT_FLOAT_EQ(stats.possessionShare(true) + stats.possessionShare(false),
+                  1.0f);
+  EXPECT_GT(stats.possessionShare(true), 0.5f);  // The stronger side
+  EXPECT_EQ(stats.forPlayer(999999), nullptr);
+}
+
+TEST(MatchEngineTest, ProfileCountsTickPhasesAndEvents)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  engine.simulateToEnd(5);
+  const MatchProfile& profile = engine.getProfile();
+
+  if constexpr (!MatchProfile::ENABLED)
+  {
+    // Compiled out: nothing is ever counted
+    EXPECT_EQ(profile.ticks, 0u);
+    for (uint64_t cycles : profile.cycles) EXPECT_EQ(cycles, 0u);
+    for (uint32_t count : profile.events) EXPECT_EQ(count, 0u);
+    return;
+  }
+
+  const MatchStats& stats = engine.getStats();
+  EXPECT_EQ(profile.ticks, engine.getTickCount());
+  EXPECT_GT(profile.cycles[MatchProfile::FORCES], 0u);
+  EXPECT_GT(profile.cycles[MatchProfile::POSSESSION], 0u);
+  EXPECT_EQ(profile.events[MatchProfile::PASS],
+            stats.home.passesAttempted + stats.away.passesAttempted);
+  EXPECT_EQ(profile.events[MatchProfile::TACKLE],
+            stats.home.tackles + stats.away.tackles);
+  EXPECT_EQ(profile.events[MatchProfile::GOAL_RESET],
+            static_cast<uint32_t>(engine.getHomeScore() +
+                                  engine.getAwayScore()));
+  EXPECT_GE(profile.events[MatchProfile::POSSESSION_CHANGE],
+            profile.events[MatchProfile::TACKLE]);
+}
+
+TEST(MatchEngineTest, FixedTimestepIsIndependentOfFrameRate)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine steady(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config, 3);
+  MatchEngine jittery(home.getLineup(), away.getLineup(), home.getStrategy(),
+                      away.getStrategy(), config, 3);
+
+  while (!steady.isFinished()) steady.update(steady.getFixedStep());
+
+  // Uneven frames, as produced by a real render loop at varying speed
+  const float frames[] = {1.0f / 60.0f, 1.0f / 30.0f, 5.0f / 60.0f, 0.002f};
+  for (size_t i = 0; !jittery.isFinished(); ++i)
+  {
+    jittery.update(frames[i % std::size(frames)]);
+  }
+
+  EXPECT_EQ(jittery.getTickCount(), steady.getTickCount());
+  EXPECT_EQ(jittery.getHomeScore(), steady.getHomeScore());
+  EXPECT_EQ(jittery.getAwayScore(), steady.getAwayScore());
+  EXPECT_EQ(jittery.getBall().position.x, steady.getBall().position.x);
+  EXPECT_EQ(jittery.getBall().position.y, steady.getBall().position.y);
+}
+
+// The tackle checks are skipped while no opponent can reach the carrier, so
+// every tick still runs and tackles still happen once they can
+TEST(MatchEngineTest, SkippedTackleChecksKeepEveryTickAndTackle)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 60, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  int tackles = 0;
+  for (uint64_t seed = 0; seed < 5; ++seed)
+  {
+    MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                       away.getStrategy(), config);
+    engine.simulateToEnd(seed);
+    EXPECT_EQ(engine.getTickCount(),
+              static_cast<uint32_t>(MatchEngine::DEFAULT_TICK_RATE *
+                                    MatchEngine::MATCH_LENGTH_MINUTES));
+    tackles += engine.getStats().home.tackles + engine.getStats().away.tackles;
+  }
+  EXPECT_GT(tackles, 0);
+}
+
+TEST(MatchEngineTest, BatchedMatchesEqualIndependentRuns)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  StatsConfig config = createUniformConfig();
+  std::vector<Team> teams;
+  for (int t = 0; t < 6; ++t)
+  {
+    teams.push_back(createDummyTeam(static_cast<TeamID>(t + 1), "Team",
+                                    45 + 8 * t, dummyPlayers));
+  }
+  // A side two players short, so lanes hold different player counts
+  Team shortHanded(9, 1, "Short", 1000, {}, Strategy(), Lineup());
+  for (unsigned int i = 0; i < 9; ++i)
+  {
+    auto p = std::make_unique<Player>(900 + i, 9, "First", "Last",
+                                      PlayerRole::ST, Language::EN, 25, 1000000,
+                                      180, 75, 60, Foot::Right,
+                                      std::map<std::string, float>{});
+    shortHanded.getLineup().addOutfieldPlayer(
+        p.get(), {0.3f + 0.05f * static_cast<float>(i), 0.1f * i});
+    dummyPlayers.push_back(std::move(p));
+  }
+  teams.push_back(shortHanded);
+
+  // More matches than lanes, so the last group is only partly filled
+  const size_t matches = 2 * MatchEngineBatch::LANES + 3;
+  MatchEngineBatch batch;
+  for (size_t m = 0; m < matches; ++m)
+  {
+    const Team& home = teams[m % teams.size()];
+    const Team& away = teams[(m * 3 + 1) % teams.size()];
+    batch.add(home.getLineup(), away.getLineup(), home.getStrategy(),
+              away.getStrategy(), config, 100 + m);
+  }
+  batch.simulateToEnd();
+
+  for (size_t m = 0; m < matches; ++m)
+  {
+    const Team& home = teams[m % teams.size()];
+    const Team& away = teams[(m * 3 + 1) % teams.size()];
+    MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                       away.getStrategy(), config);
+    engine.simulateToEnd(100 + m);
+
+    const MatchEngine& batched = batch[m];
+    ASSERT_TRUE(batched.isFinished());
+    EXPECT_EQ(batched.getHomeScore(), engine.getHomeScore());
+    EXPECT_EQ(batched.getAwayScore(), engine.getAwayScore());
+    EXPECT_EQ(batched.getTickCount(), engine.getTickCount());
+    ASSERT_EQ(batched.getEvents().size(), engine.getEvents().size());
+    for (size_t i = 0; i < engine.getPlayers().size(); ++i)
+    {
+      EXPECT_EQ(batched.getKinematics().x[i], engine.getKinematics().x[i]);
+      EXPECT_EQ(batched.getKinematics().y[i], engine.getKinematics().y[i]);
+    }
+  }
+}
+
+TEST(MatchEngineTest, SkippedMatchEndsAsIfWatched)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine watched(home.getLineup(), away.getLineup(), home.getStrategy(),
+                      away.getStrategy(), config, 11);
+  while (watched.getMatchTimeMinutes() < 30.0f) watched.update(1.0f / 60.0f);
+
+  // The snapshot continues the live streams instead of reseeding
+  MatchEngine skipped(watched);
+  std::vector<float> minutes;
+  skipped.simulateRemaining(
+      [&minutes](float minute)
+      {
+        minutes.push_back(minute);
+        return true;
+      });
+  while (!watched.isFinished()) watched.update(watched.getFixedStep());
+
+  EXPECT_TRUE(skipped.isFinished());
+  EXPECT_EQ(skipped.getTickCount(), watched.getTickCount());
+  EXPECT_EQ(skipped.getHomeScore(), watched.getHomeScore());
+  EXPECT_EQ(skipped.getAwayScore(), watched.getAwayScore());
+  EXPECT_EQ(skipped.getEvents().size(), watched.getEvents().size());
+  ASSERT_FALSE(minutes.empty());
+  EXPECT_GE(minutes.back(), MatchEngine::MATCH_LENGTH_MINUTES - 1e-3f);
+
+  // Returning false from the callback stops the run
+  MatchEngine cancelled(home.getLineup(), away.getLineup(), home.getStrategy(),
+                        away.getStrategy(), config, 11);
+  cancelled.simulateRemaining([](float) { return false; });
+  EXPECT_FALSE(cancelled.isFinished());
+  EXPECT_EQ(cancelled.getTickCount(),
+            static_cast<uint32_t>(cancelled.getTickRate()));
+}
+
+TEST(MatchEngineTest, ReplayIsCompactAndSeekable)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config, 9);
+  MatchReplayRecorder recorder;
+  engine.setRecorder(&recorder);
+
+  // Remember a few ticks to compare against the decoded replay
+  const uint32_t probes[] = {0, 1, 59, 60, 61, 1000, 1799};
+  std::vector<MatchRenderState> expected;
+  std::vector<int> expectedHome;
+  for (uint32_t tick = 0; !engine.isFinished(); ++tick)
+  {
+    if (std::ranges::find(probes, tick) != std::end(probes))
+    {
+      MatchRenderState state;
+      state.x = engine.getKinematics().x;
+      state.y = engine.getKinematics().y;
+      state.ball = engine.getBall().position;
+      expected.push_back(state);
+      expectedHome.push_back(engine.getHomeScore());
+    }
+    engine.update(engine.getFixedStep());
+  }
+  EXPECT_EQ(recorder.getFrameCount(), engine.getTickCount() + 1);
+
+  std::vector<uint8_t> bytes = recorder.toBytes();
+  EXPECT_LT(bytes.size(), 400u * 1024u);
+
+  auto replay = MatchReplay::fromBytes(bytes);
+  ASSERT_TRUE(replay.has_value());
+  ASSERT_EQ(replay->getSlotCount(), engine.getPlayers().size());
+  EXPECT_TRUE(replay->isHomeSlot(0));
+  EXPECT_FALSE(replay->isHomeSlot(replay->getSlotCount() - 1));
+
+  // Seek out of order, positions are within one fixed point step
+  const float tolerance = 1.0f / 65535.0f;
+  for (size_t p = std::size(probes); p-- > 0;)
+  {
+    ReplayFrame frame = replay->frameAt(probes[p]);
+    for (size_t i = 0; i < replay->getSlotCount(); ++i)
+    {
+      EXPECT_NEAR(frame.players[i].x,
+                  std::clamp(expected[p].x[i], 0.0f, 1.0f), tolerance);
+      EXPECT_NEAR(frame.players[i].y,
+                  std::clamp(expected[p].y[i], 0.0f, 1.0f), tolerance);
+    }
+    EXPECT_NEAR(frame.ball.x, expected[p].ball.x, tolerance);
+    EXPECT_NEAR(frame.timeMinute, probes[p] * engine.getFixedStep(), 0.01f);
+    EXPECT_EQ(frame.homeScore, expectedHome[p]);
+  }
+
+  ReplayFrame last = replay->frameAt(replay->getFrameCount() - 1);
+  EXPECT_EQ(last.homeScore, engine.getHomeScore());
+  EXPECT_EQ(last.awayScore, engine.getAwayScore());
+
+  // Truncated files are rejected instead of read past their end
+  bytes.resize(bytes.size() / 2);
+  EXPECT_FALSE(MatchReplay::fromBytes(bytes).has_value());
+}
+
+TEST(MatchEngineTest, RestoredSnapshotPlaysOutIdentically)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine original(home.getLineup(), away.getLineup(), home.getStrategy(),
+                       away.getStrategy(), config, 21);
+  while (original.getMatchTimeMinutes() < 25.0f) original.update(0.05f);
+  const MatchEngineSnapshot state = original.snapshot();
+  const MatchEngineSnapshot sameState = original.snapshot();
+  original.simulateRemaining();
+
+  // A fresh engine with another seed takes over the snapshot completely
+  MatchEngine resumed(home.getLineup(), away.getLineup(), home.getStrategy(),
+                      away.getStrategy(), config, 99);
+  ASSERT_TRUE(resumed.restore(state));
+  EXPECT_EQ(resumed.getTickCount(), state.tickCount);
+  resumed.simulateRemaining();
+
+  EXPECT_EQ(resumed.getTickCount(), original.getTickCount());
+  EXPECT_EQ(resumed.getHomeScore(), original.getHomeScore());
+  EXPECT_EQ(resumed.getAwayScore(), original.getAwayScore());
+  EXPECT_EQ(resumed.getEvents().size(), original.getEvents().size());
+  EXPECT_EQ(resumed.getBall().position.x, original.getBall().position.x);
+
+  // Rewinding the finished original itself works as well
+  ASSERT_TRUE(original.restore(sameState));
+  EXPECT_FALSE(original.isFinished());
+
+  // Unknown players are rejected without touching the engine
+  const uint32_t ticks = resumed.getTickCount();
+  EXPECT_FALSE(resumed.restore(state, [](PlayerID) { return nullptr; }));
+  EXPECT_EQ(resumed.getTickCount(), ticks);
+}
+
+TEST(MatchEngineTest, ForksBranchFromTheLiveMatch)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 65, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 65, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine live(home.getLineup(), away.getLineup(), home.getStrategy(),
+                   away.getStrategy(), config, 5);
+  while (live.getMatchTimeMinutes() < 60.0f) live.update(0.05f);
+
+  // Without a seed the fork is the same continuation, minus the history
+  MatchEngine same = live.fork();
+  EXPECT_TRUE(same.getEvents().empty());
+  EXPECT_EQ(same.getHomeScore(), live.getHomeScore());
+  same.simulateRemaining();
+
+  std::vector<MatchEngine> branches;
+  for (uint64_t s = 0; s < 8; ++s) branches.push_back(live.fork(1000 + s));
+  ThreadPool pool(2);
+  pool.parallelFor(branches.size(),
+                   [&branches](size_t i) { branches[i].simulateRemaining(); });
+
+  live.simulateRemaining();
+  EXPECT_EQ(same.getHomeScore(), live.getHomeScore());
+  EXPECT_EQ(same.getAwayScore(), live.getAwayScore());
+  EXPECT_EQ(same.getBall().position.x, live.getBall().position.x);
+
+  // Reseeded forks play out different continuations
+  size_t distinct = 0;
+  for (const MatchEngine& branch : branches)
+  {
+    EXPECT_TRUE(branch.isFinished());
+    if (branch.getBall().position.x != live.getBall().position.x) ++distinct;
+  }
+  EXPECT_GT(distinct, 0u);
+}
+
+TEST(MatchEngineTest, PlaybackSpeedScalesTickCount)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  engine.setTickRate(40);
+  const float step = engine.getFixedStep();
+
+  engine.update(step * 0.5f);  // Not enough for a tick yet
+  EXPECT_EQ(engine.getTickCount(), 0u);
+  EXPECT_NEAR(engine.getInterpolationAlpha(), 0.5f, 1e-5f);
+
+  engine.update(step * 0.5f);
+  EXPECT_EQ(engine.getTickCount(), 1u);
+
+  engine.update(step * 5.0f);  // 5x playback for one frame
+  EXPECT_EQ(engine.getTickCount(), 6u);
+
+  // Interpolated positions lie between the previous and current tick
+  const MatchRenderState& previous = engine.getPreviousState();
+  engine.update(step * 0.25f);
+  for (size_t i = 0; i < engine.getPlayers().size(); ++i)
+  {
+    const float current = engine.getKinematics().x[i];
+    const float lerped = engine.interpolatedPlayerPosition(i).x;
+    EXPECT_GE(lerped, std::min(previous.x[i], current) - 1e-6f);
+    EXPECT_LE(lerped, std::max(previous.x[i], current) + 1e-6f);
+  }
+}
+
+TEST(MatchEngineTest, VectorizedKinematicsMatchScalarReference)
+{
+  // Crowded random state so that pressing, repulsion and both clamps trigger
+  std::mt19937 rng(99);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  MatchKinematics simd;
+  for (int i = 0; i < 22; ++i)
+  {
+    float x = 0.4f + unit(rng) * 0.2f;
+    float y = 0.4f + unit(rng) * 0.2f;
+    size_t idx = simd.add({x, y}, 0.05f + unit(rng) * 0.15f,
+                          0.1f + unit(rng) * 0.2f);
+    simd.setVelocity(idx, {unit(rng) - 0.5f, unit(rng) - 0.5f});
+    simd.steerX[idx] = (i % 7 == 0) ? 1.0f : 0.0f;
+    simd.pull[idx] = (i % 7 == 0) ? 0.0f : 0.5f;
+    simd.targetX[idx] = unit(rng);
+    simd.targetY[idx] = unit(rng);
+    simd.pressRadius[idx] = (i % 2 == 0) ? 0.1f + unit(rng) * 0.3f : 0.0f;
+    simd.pressAggression[idx] = 0.5f + unit(rng);
+  }
+  MatchKinematics scalar = simd;
+
+  for (int tick = 0; tick < 200; ++tick)
+  {
+    simd.integrate({0.5f, 0.5f}, 0.05f);
+    scalar.integrateScalar({0.5f, 0.5f}, 0.05f);
+  }
+
+  for (size_t i = 0; i < simd.count; ++i)
+  {
+    EXPECT_FLOAT_EQ(simd.x[i], scalar.x[i]) << MatchKinematics::kernelName();
+    EXPECT_FLOAT_EQ(simd.y[i], scalar.y[i]);
+    EXPECT_FLOAT_EQ(simd.vx[i], scalar.vx[i]);
+    EXPECT_FLOAT_EQ(simd.vy[i], scalar.vy[i]);
+  }
+  // Padding slots stay parked off the pitch
+  EXPECT_EQ(simd.x[simd.count], MatchKinematics::PARKED_POSITION);
+}
+
+// Polls until every run of the latest prediction has been merged
+MatchPrediction waitForPrediction(const MatchPredictor& predictor)
+{
+  MatchPrediction prediction = predictor.getPrediction();
+  while (!prediction.isComplete())
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    prediction = predictor.getPrediction();
+  }
+  return prediction;
+}
+
+TEST(MatchPredictorTest, AggregatesSeededHeadlessRuns)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 70, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 55, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+  constexpr int RUNS = 60;
+
+  ThreadPool pool(2);
+  MatchPredictor predictor(pool);
+  predictor.predict(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config, RUNS);
+  MatchPrediction prediction = waitForPrediction(predictor);
+
+  // Run i is the headless match with seed i
+  int homeWins = 0;
+  int homeGoals = 0;
+  int awayGoals = 0;
+  for (int run = 0; run < RUNS; ++run)
+  {
+    MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                       away.getStrategy(), config, run);
+    engine.simulateToEnd(run);
+    homeWins += engine.getHomeScore() > engine.getAwayScore();
+    homeGoals += engine.getHomeScore();
+    awayGoals += engine.getAwayScore();
+  }
+
+  EXPECT_EQ(prediction.completedRuns, RUNS);
+  EXPECT_FALSE(predictor.isRunning());
+  EXPECT_FLOAT_EQ(prediction.homeWin, homeWins / float(RUNS));
+  EXPECT_FLOAT_EQ(prediction.expectedHomeGoals, homeGoals / float(RUNS));
+  EXPECT_FLOAT_EQ(prediction.expectedAwayGoals, awayGoals / float(RUNS));
+  EXPECT_NEAR(prediction.homeWin + prediction.draw + prediction.awayWin, 1.0f,
+              1e-5f);
+
+  float homeBuckets = 0.0f;
+  for (float p : prediction.homeGoals) homeBuckets += p;
+  EXPECT_NEAR(homeBuckets, 1.0f, 1e-5f);
+
+  MatchPrediction flipped = prediction.flipped();
+  EXPECT_EQ(flipped.homeWin, prediction.awayWin);
+  EXPECT_EQ(flipped.expectedAwayGoals, prediction.expectedHomeGoals);
+}
+
+TEST(MatchPredictorTest, NewPredictionSupersedesRunningOne)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 60, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  ThreadPool pool(2);
+  MatchPredictor predictor(pool);
+  predictor.predict(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config);
+
+  // Only the latest prediction may contribute runs
+  Strategy attacking = home.getStrategy();
+  attacking.setAllSliders({0.9f, 0.9f, 0.9f, 0.5f, 0.2f});
+  predictor.predict(home.getLineup(), away.getLineup(), attacking,
+                    away.getStrategy(), config, 40);
+  MatchPrediction prediction = waitForPrediction(predictor);
+  EXPECT_EQ(prediction.requestedRuns, 40);
+  EXPECT_EQ(prediction.completedRuns, 40);
+
+  predictor.predict(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config);
+  predictor.cancel();
+  EXPECT_FALSE(predictor.isRunning());
+  EXPECT_EQ(predictor.getPrediction().completedRuns, 0);
+}
+
+TEST(MatchPredictorTest, PredictDoesNotWaitForBusyPool)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 60, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  // The only worker is held by another job, so no chunk can start or end
+  ThreadPool pool(1);
+  std::promise<void> started;
+  std::promise<void> release;
+  auto busy = pool.submit(
+      [&started, &release]()
+      {
+        started.set_value();
+        release.get_future().wait();
+      });
+  started.get_future().wait();
+
+  MatchPredictor predictor(pool);
+  Strategy attacking = home.getStrategy();
+  attacking.setAllSliders({0.9f, 0.9f, 0.9f, 0.5f, 0.2f});
+  predictor.predict(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config, 40);
+  predictor.predict(home.getLineup(), away.getLineup(), attacking,
+                    away.getStrategy(), config, 40);
+  EXPECT_EQ(predictor.getPrediction().completedRuns, 0);
+
+  release.set_value();
+  busy.get();
+  EXPECT_EQ(waitForPrediction(predictor).completedRuns, 40);
+}
+
+TEST(MatchPredictorTest, KeepsRunsOfUnchangedInputs)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createDummyTeam(1, "Home", 65, dummyPlayers);
+  Team away = createDummyTeam(2, "Away", 55, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  ThreadPool pool(2);
+  MatchPredictor predictor(pool);
+  predictor.predict(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config, 40);
+  const MatchPrediction first = waitForPrediction(predictor);
+
+  Strategy attacking = home.getStrategy();
+  attacking.setAllSliders({0.9f, 0.9f, 0.9f, 0.5f, 0.2f});
+  predictor.predict(home.getLineup(), away.getLineup(), attacking,
+                    away.getStrategy(), config, 40);
+  waitForPrediction(predictor);
+
+  // Moving the sliders back finds every run already done
+  predictor.predict(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config, 40);
+  MatchPrediction back = predictor.getPrediction();
+  EXPECT_TRUE(back.isComplete());
+  EXPECT_EQ(back.homeWin, first.homeWin);
+  EXPECT_EQ(back.expectedAwayGoals, first.expectedAwayGoals);
+
+  // More runs only add the missing ones, seeds 40 to 59
+  predictor.predict(home.getLineup(), away.getLineup(), home.getStrategy(),
+                    away.getStrategy(), config, 60);
+  EXPECT_GE(predictor.getPrediction().completedRuns, 40);
+  EXPECT_EQ(waitForPrediction(predictor).completedRuns, 60);
+}
+
+// Helper that builds a rated 4-4-2 with a goalkeeper, the shape the
+// statistical tier is fitted to
+Team createFormationTeam(TeamID id, int rating,
+                         std::vector<std::unique_ptr<Player>>& dummy_players)
+{
+  Team team(id, 1, "Team", 1000, {}, Strategy(), Lineup());
+  const auto r = static_cast<float>(rating);
+  std::map<std::string, float> stats = {
+      {"Pace", r}, {"Shooting", r}, {"Passing", r}, {"Defending", r}};
+  auto keeper = std::make_unique<Player>(id * 100, id, "First", "Last",
+                                         PlayerRole::GK, Language::EN, 25,
+                                         1000000, 180, 75, rating, Foot::Right,
+                                         stats);
+  team.getLineup().setGoalkeeper(keeper.get());
+  dummy_players.push_back(std::move(keeper));
+
+  const Vector2F shape[10] = {{0.2f, 0.2f}, {0.2f, 0.4f}, {0.2f, 0.6f},
+                              {0.2f, 0.8f}, {0.4f, 0.2f}, {0.4f, 0.4f},
+                              {0.4f, 0.6f}, {0.4f, 0.8f}, {0.6f, 0.4f},
+                              {0.6f, 0.6f}};
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    auto p = std::make_unique<Player>(id * 100 + 1 + i, id, "First", "Last",
+                                      PlayerRole::ST, Language::EN, 25, 1000000,
+                                      180, 75, rating, Foot::Right, stats);
+    team.getLineup().addOutfieldPlayer(p.get(), shape[i]);
+    dummy_players.push_back(std::move(p));
+  }
+  return team;
+}
+
+TEST(MatchEngineTest, ExpectedGoalsTrackShotConversion)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  StatsConfig config = createUniformConfig();
+  Team home = createFormationTeam(1, 65, dummyPlayers);
+  Team away = createFormationTeam(2, 60, dummyPlayers);
+
+  float expected = 0.0f;
+  int scored = 0;
+  for (uint64_t seed = 0; seed < 60; ++seed)
+  {
+    MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                       away.getStrategy(), config);
+    engine.simulateToEnd(seed);
+    expected += engine.getStats().home.expectedGoals +
+                engine.getStats().away.expectedGoals;
+
+    // A shot scored if its side's goal comes before anyone touches the ball
+    const auto& events = engine.getEvents();
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+      if (events[i].type != MatchEventType::SHOT) continue;
+      for (size_t j = i + 1; j < events.size(); ++j)
+      {
+        if (events[j].type == MatchEventType::GOAL)
+        {
+          scored += events[j].isHomeTeam == events[i].isHomeTeam ? 1 : 0;
+          break;
+        }
+        if (events[j].type == MatchEventType::CONTROL ||
+            events[j].type == MatchEventType::TACKLE)
+        {
+          break;
+        }
+      }
+    }
+  }
+
+  ASSERT_GT(scored, 0);
+  EXPECT_NEAR(expected / static_cast<float>(scored), 1.0f, 0.15f);
+}
+
+TEST(MatchEngineTest, HeatmapsCoverEveryTrackedTick)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  StatsConfig config = createUniformConfig();
+  Team home = createFormationTeam(1, 65, dummyPlayers);
+  Team away = createFormationTeam(2, 60, dummyPlayers);
+  auto heatmaps = std::make_unique<MatchHeatmaps>();
+
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config);
+  engine.setHeatmaps(heatmaps.get());
+  engine.simulateToEnd(5);
+
+  const MatchStats& stats = engine.getStats();
+  ASSERT_GT(stats.playerCount, 0u);
+  for (size_t line = 0; line < stats.playerCount; ++line)
+  {
+    EXPECT_EQ(heatmaps->lines[line].total(),
+              static_cast<uint32_t>(MatchEngine::DEFAULT_TICK_RATE *
+                                    MatchEngine::MATCH_LENGTH_MINUTES));
+  }
+
+  // The home keeper hardly leaves the defensive third
+  const PlayerHeatmap& keeper = heatmaps->lines[0];
+  uint32_t ownThird = 0;
+  for (size_t cell = 0; cell < PlayerHeatmap::CELLS; ++cell)
+  {
+    if (cell % PlayerHeatmap::COLUMNS < PlayerHeatmap::COLUMNS / 3)
+    {
+      ownThird += keeper.cells[cell];
+    }
+  }
+  EXPECT_GT(ownThird, keeper.total() * 9 / 10);
+
+  // Switched off, the grids are left alone
+  heatmaps->clear();
+  MatchEngine untracked(home.getLineup(), away.getLineup(), home.getStrategy(),
+                        away.getStrategy(), config);
+  untracked.setHeatmaps(heatmaps.get());
+  untracked.setHeatmaps(nullptr);
+  untracked.simulateToEnd(5);
+  for (const PlayerHeatmap& grid : heatmaps->lines)
+  {
+    EXPECT_EQ(grid.total(), 0u);
+  }
+}
+
+TEST(MatchEngineTest, SeasonHeatmapsEncodeCompactly)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  StatsConfig config = createUniformConfig();
+  Team home = createFormationTeam(1, 60, dummyPlayers);
+  Team away = createFormationTeam(2, 60, dummyPlayers);
+  auto heatmaps = std::make_unique<MatchHeatmaps>();
+
+  SeasonHeatmap keeper;
+  SeasonHeatmap striker;
+  for (uint64_t seed = 1; seed <= 3; ++seed)
+  {
+    heatmaps->clear();
+    MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                       away.getStrategy(), config);
+    engine.setHeatmaps(heatmaps.get());
+    engine.simulateToEnd(seed);
+    keeper.add(heatmaps->lines[0]);
+    striker.add(heatmaps->lines[10]);
+  }
+  EXPECT_EQ(keeper.matches, 3);
+
+  for (const SeasonHeatmap* season : {&keeper, &striker})
+  {
+    const std::vector<uint8_t> bytes = season->encode();
+    EXPECT_LT(bytes.size(), sizeof(season->cells) / 2);
+
+    const auto decoded = SeasonHeatmap::decode(bytes);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->cells, season->cells);
+    EXPECT_EQ(decoded->matches, season->matches);
+
+    // Truncated data is rejected rather than read past
+    EXPECT_FALSE(SeasonHeatmap::decode(
+                     std::span(bytes.data(), bytes.size() - 1))
+                     .has_value());
+  }
+}
+
+TEST(MatchSimulatorTest, TiersAreSharedAndDeterministic)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createFormationTeam(1, 70, dummyPlayers);
+  Team away = createFormationTeam(2, 55, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  for (SimulationTier tier :
+       {SimulationTier::STATISTICAL, SimulationTier::REDUCED_PHYSICS,
+        SimulationTier::FULL_PHYSICS})
+  {
+    const MatchSimulator& simulator = MatchSimulator::forTier(tier);
+    EXPECT_EQ(simulator.getTier(), tier);
+    EXPECT_EQ(&simulator, &MatchSimulator::forTier(tier));
+
+    MatchScore first = simulator.simulate(home, away, config, 11);
+    MatchScore second = simulator.simulate(home, away, config, 11);
+    EXPECT_EQ(first.home, second.home);
+    EXPECT_EQ(first.away, second.away);
+  }
+
+  // The full tier is exactly the headless engine
+  MatchEngine engine(home.getLineup(), away.getLineup(), home.getStrategy(),
+                     away.getStrategy(), config, 11);
+  engine.simulateToEnd(11);
+  MatchScore full = MatchSimulator::forTier(SimulationTier::FULL_PHYSICS)
+                        .simulate(home, away, config, 11);
+  EXPECT_EQ(full.home, engine.getHomeScore());
+  EXPECT_EQ(full.away, engine.getAwayScore());
+}
+
+TEST(MatchEngineTest, ResetEnginePlaysLikeANewOne)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createFormationTeam(1, 65, dummyPlayers);
+  Team away = createFormationTeam(2, 60, dummyPlayers);
+  Team other = createFormationTeam(3, 70, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+
+  // Leave plenty of state behind: a substitution, heatmaps, a full match
+  MatchEngine reused(home.getLineup(), home.getLineup(), home.getStrategy(),
+                     home.getStrategy(), config, 3);
+  MatchHeatmaps heatmaps;
+  reused.setHeatmaps(&heatmaps);
+  reused.update(30.0f);
+  reused.substitutePlayer(reused.getPlayers().back().player->getId(),
+                          other.getLineup().getGoalkeeper());
+  reused.simulateRemaining();
+
+  reused.reset(away.getLineup(), other.getLineup(), away.getStrategy(),
+               other.getStrategy(), config, 7);
+  MatchEngine fresh(away.getLineup(), other.getLineup(), away.getStrategy(),
+                    other.getStrategy(), config, 7);
+  EXPECT_EQ(reused.getHeatmaps(), nullptr);
+  EXPECT_EQ(reused.getEvents().size(), 1u);
+
+  reused.simulateToEnd(7);
+  fresh.simulateToEnd(7);
+  EXPECT_EQ(reused.getHomeScore(), fresh.getHomeScore());
+  EXPECT_EQ(reused.getAwayScore(), fresh.getAwayScore());
+  ASSERT_EQ(reused.getEvents().size(), fresh.getEvents().size());
+  for (size_t i = 0; i < fresh.getEvents().size(); ++i)
+  {
+    EXPECT_EQ(reused.getEvents()[i].type, fresh.getEvents()[i].type);
+    EXPECT_EQ(reused.getEvents()[i].tick, fresh.getEvents()[i].tick);
+  }
+  EXPECT_EQ(reused.getStats().playerCount, fresh.getStats().playerCount);
+  EXPECT_EQ(reused.getStats().home.passesCompleted,
+            fresh.getStats().home.passesCompleted);
+}
+
+TEST(MatchSimulatorTest, PooledMatchesDoNotAllocate)
+{
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createFormationTeam(1, 65, dummyPlayers);
+  Team away = createFormationTeam(2, 60, dummyPlayers);
+  StatsConfig config = createUniformConfig();
+  const PhysicsSimulator simulator;
+
+  // The first match builds the engine this thread keeps reusing
+  simulator.simulate(home, away, config, 0);
+
+  const size_t before = allocationCount;
+  for (uint64_t seed = 1; seed <= 10; ++seed)
+  {
+    simulator.simulate(home, away, config, seed);
+    simulator.simulate(away, home, config, seed);
+  }
+  EXPECT_EQ(allocationCount, before);
+
+  // Engines on loan at the same time are separate
+  MatchEnginePool pool;
+  {
+    MatchEnginePool::Lease first = pool.acquire(
+        home.getLineup(), away.getLineup(), home.getStrategy(),
+        away.getStrategy(), config);
+    MatchEnginePool::Lease second = pool.acquire(
+        home.getLineup(), away.getLineup(), home.getStrategy(),
+        away.getStrategy(), config);
+    EXPECT_NE(&*first, &*second);
+    EXPECT_EQ(pool.idleCount(), 0u);
+  }
+  EXPECT_EQ(pool.idleCount(), 2u);
+}
+
+// The statistical tier keeps the game's long-standing goal model rather than
+// following the engine: about 1.5 home and 1.2 away goals between equal sides
+TEST(MatchSimulatorTest, StatisticalTierKeepsBaselineScoring)
+{
+  StatsConfig config = createUniformConfig();
+  std::vector<std::unique_ptr<Player>> dummyPlayers;
+  Team home = createFormationTeam(1, 60, dummyPlayers);
+  Team away = createFormationTeam(2, 60, dummyPlayers);
+
+  EXPECT_FLOAT_EQ(StatisticalSimulator::expectedGoals(60, 60, true), 1.5f);
+  EXPECT_FLOAT_EQ(StatisticalSimulator::expectedGoals(60, 60, false), 1.2f);
+
+  MatchPrediction outcome = sampleOutcomes(
+      MatchSimulator::forTier(SimulationTier::STATISTICAL), home, away, config,
+      4000);
+  EXPECT_NEAR(outcome.expectedHomeGoals, 1.5f, 0.1f);
+  EXPECT_NEAR(outcome.expectedAwayGoals, 1.2f, 0.1f);
+  EXPECT_GT(outcome.homeWin, outcome.awayWin);
+}
+
+// Calibration harness: the reduced tier has to stay close to the full engine's
+// outcome distribution over a range of rating matchups. The statistical tier
+// scores far less (see above), so only its results have to agree.
+TEST(MatchSimulatorTest, CheaperTiersTrackFullEngine)
+{
+  StatsConfig config = createUniformConfig();
+  constexpr int RUNS = 160;
+  const std::pair<int, int> matchups[] = {{60, 60}, {75, 60}, {50, 80}};
+
+  for (auto [homeRating, awayRating] : matchups)
+  {
+    std::vector<std::unique_ptr<Player>> dummyPlayers;
+    Team home = createFormationTeam(1, homeRating, dummyPlayers);
+    Team away = createFormationTeam(2, awayRating, dummyPlayers);
+    MatchPrediction reference = sampleOutcomes(
+        MatchSimulator::forTier(SimulationTier::FULL_PHYSICS), home, away,
+        config, RUNS);
+
+    TierCalibration statistical = compareOutcomes(
+        sampleOutcomes(MatchSimulator::forTier(SimulationTier::STATISTICAL),
+                       home, away, config, RUNS),
+        reference);
+    {
+      SCOPED_TRACE(::testing::Message()
+                   << "statistical tier, " << homeRating << " v "
+                   << awayRating << ": goals " << statistical.goalError
+                   << ", results " << statistical.resultError
+                   << ", histogram " << statistical.goalDistance);
+      EXPECT_LT(statistical.resultError, 0.2f);
+    }
+
+    TierCalibration calibration = compareOutcomes(
+        sampleOutcomes(MatchSimulator::forTier(SimulationTier::REDUCED_PHYSICS),
+                       home, away, config, RUNS),
+        reference);
+    SCOPED_TRACE(::testing::Message()
+                 << "reduced tier, " << homeRating << " v " << awayRating
+                 << ": goals " << calibration.goalError << ", results "
+                 << calibration.resultError << ", histogram "
+                 << calibration.goalDistance);
+    EXPECT_LT(calibration.goalError, 1.0f);
+    EXPECT_LT(calibration.resultError, 0.15f);
+    EXPECT_LT(calibration.goalDistance, 0.25f);
+  }
+}
@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 
+#include "global/random_stream.h"
 #include "global/stats_config.h"
 #include "model/player.h"
 
@@ -79,11 +80,33 @@ TEST(PlayerTest, Train)
   // for 20 is positive. So it should strictly increase unless rng hits 0.0
   // exactly. We can loop a few times to ensure increase.
 
+  RandomStream rng(7);
   float initial_speed = p.getStats().at("Speed");
   for (int i = 0; i < 10; ++i)
   {
-    p.train({"Speed"});
+    p.train({"Speed"}, rng);
   }
 
   EXPECT_GT(p.getStats().at("Speed"), initial_speed);
 }
+
+TEST(PlayerTest, TrainIsReproducible)
+{
+  std::map<std::string, float> stats = {
+      {"Speed", 50.0f}, {"Passing", 50.0f}, {"Tackling", 50.0f}};
+  Player a(1, 10, "Trainee", "Boy", PlayerRole::ST, Language::EN, 1000, 1, 20,
+           3, 180, Foot::Right, stats);
+  Player b = a;
+
+  // Same seed, same stream: the same stats are picked and grown by the same
+  // amounts, on any platform
+  RandomStream rng_a(42, 1);
+  RandomStream rng_b(42, 1);
+  for (int i = 0; i < 20; ++i)
+  {
+    a.train({"Speed", "Passing"}, rng_a);
+    b.train({"Speed", "Passing"}, rng_b);
+  }
+
+  EXPECT_EQ(a.getStats(), b.getStats());
+}
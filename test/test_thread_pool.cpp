@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------
+//  Football Management Project
+//  Copyright (c) 2025 - 2026 Flavio Milinanni. All Rights Reserved.
+//
+//  This file is part of the Football Management Project.
+//  See the LICENSE file in the project root.
+// -----------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "global/thread_pool.h"
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce)
+{
+  ThreadPool pool(4);
+  std::vector<std::atomic<int>> visits(1000);
+
+  pool.parallelFor(visits.size(), [&visits](size_t i) { visits[i]++; });
+
+  for (const auto& v : visits)
+  {
+    EXPECT_EQ(v.load(), 1);
+  }
+}
+
+TEST(ThreadPoolTest, SubmitReturnsResult)
+{
+  ThreadPool pool(2);
+  auto answer = pool.submit([]() { return 6 * 7; });
+  EXPECT_EQ(answer.get(), 42);
+}
+
+TEST(ThreadPoolTest, ParallelForRethrowsFirstException)
+{
+  ThreadPool pool(3);
+  std::atomic<int> completed{0};
+
+  EXPECT_THROW(pool.parallelFor(64,
+                                [&completed](size_t i)
+                                {
+                                  if (i == 17) throw std::runtime_error("x");
+                                  completed++;
+                                }),
+               std::runtime_error);
+  EXPECT_EQ(completed.load(), 63);  // Other indices still ran
+}
+
+TEST(ThreadPoolTest, NestedParallelForDoesNotDeadlock)
+{
+  ThreadPool pool(2);
+  std::atomic<int> total{0};
+
+  pool.parallelFor(8,
+                   [&pool, &total](size_t)
+                   {
+                     pool.parallelFor(8, [&total](size_t) { total++; });
+                   });
+
+  EXPECT_EQ(total.load(), 64);
+}
+
+TEST(ThreadPoolTest, ParallelForCallerRunsOnlyItsOwnRange)
+{
+  ThreadPool pool(1);
+  std::promise<void> started;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  auto busy = pool.submit(
+      [&started, released]()
+      {
+        started.set_value();
+        released.wait();
+      });
+  started.get_future().wait();
+  auto unrelated = pool.submit([]() { return std::this_thread::get_id(); });
+
+  // The only worker is busy, so the caller covers the whole range alone and
+  // returns without taking the unrelated task queued behind its helper
+  std::atomic<int> total{0};
+  pool.parallelFor(16, [&total](size_t) { total++; });
+  EXPECT_EQ(total.load(), 16);
+
+  release.set_value();
+  busy.get();
+  EXPECT_NE(unrelated.get(), std::this_thread::get_id());
+}